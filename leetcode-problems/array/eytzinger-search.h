@@ -0,0 +1,137 @@
+/*
+╔══════════════════════════════════════════════════════════════════════════════╗
+║                             SHARED ARRAY UTILITY                             ║
+╠══════════════════════════════════════════════════════════════════════════════╣
+║ Component     : EytzingerSearch                                              ║
+║ Used By       : leetcode-33.cpp, leetcode-74.cpp                             ║
+║ Topic         : Binary Search, Cache-Friendly Layout                         ║
+╚══════════════════════════════════════════════════════════════════════════════╝
+
+📋 DESCRIPTION:
+Static lower_bound over a sorted key set. Keys are stored in Eytzinger
+(BFS) order: node k has children 2k and 2k + 1, so the first levels of
+every search share the same few cache lines, and the next lines on the
+path can be prefetched ahead of time.
+
+The descent is branch-free: every step is k = 2k + (key[k] < x). The
+answer is the last node where the path went left, which is recovered by
+stripping the trailing 1 bits and one 0 bit from k.
+
+lowerBoundBatch() walks a group of queries level by level in lockstep,
+so the cache misses of different queries are in flight at the same time.
+
+⏰ TIME COMPLEXITY: O(n) build, O(log n) per query
+💾 SPACE COMPLEXITY: O(n)
+*/
+
+#pragma once
+
+class EytzingerSearch {
+public:
+    // Number of queries advanced together by lowerBoundBatch().
+    static const int GROUP = 16;
+
+    EytzingerSearch() = default;
+
+    explicit EytzingerSearch(const vector<int>& sorted) {
+
+        n = sorted.size();
+
+        key.assign(n + 1, 0);
+        rank.assign(n + 1, -1);
+
+        int next = 0;
+        fillInOrder(sorted, next, 1);
+
+        depth = 0;
+
+        while ((2 << depth) <= n + 1) {
+            depth++;
+        }
+    }
+
+    int size() const {
+        return n;
+    }
+
+    // Position of the first key >= x in the sorted order, or size().
+    int lowerBound(int x) const {
+
+        int k = 1;
+
+        while (k <= n) {
+            __builtin_prefetch(key.data() + min(16 * k, n));
+            k = 2 * k + (key[k] < x);
+        }
+
+        return resolve(k);
+    }
+
+    void lowerBoundBatch(const int* queries, int* out, size_t m) const {
+
+        size_t i = 0;
+
+        for (; i + GROUP <= m; i += GROUP) {
+            lowerBoundGroup(queries + i, out + i, GROUP);
+        }
+
+        lowerBoundGroup(queries + i, out + i, m - i);
+    }
+
+private:
+    int n = 0;
+    int depth = 0;
+
+    vector<int> key;
+    vector<int> rank;
+
+    void fillInOrder(const vector<int>& sorted, int& next, int k) {
+
+        if (k > n) {
+            return;
+        }
+
+        fillInOrder(sorted, next, 2 * k);
+
+        key[k] = sorted[next];
+        rank[k] = next++;
+
+        fillInOrder(sorted, next, 2 * k + 1);
+    }
+
+    int resolve(int k) const {
+
+        k >>= __builtin_ffs(~k);
+
+        return k == 0 ? n : rank[k];
+    }
+
+    void lowerBoundGroup(const int* queries, int* out, int m) const {
+
+        int k[GROUP];
+
+        for (int q = 0; q < m; q++) {
+            k[q] = 1;
+        }
+
+        // Every node on the first `depth` levels exists, so these steps need
+        // no bounds check and all queries advance together.
+        for (int level = 0; level < depth; level++) {
+
+            for (int q = 0; q < m; q++) {
+                k[q] = 2 * k[q] + (key[k[q]] < queries[q]);
+                __builtin_prefetch(key.data() + min(2 * k[q], n));
+            }
+        }
+
+        // The last level may be partial.
+        for (int q = 0; q < m; q++) {
+
+            if (k[q] <= n) {
+                k[q] = 2 * k[q] + (key[k[q]] < queries[q]);
+            }
+
+            out[q] = resolve(k[q]);
+        }
+    }
+};
@@ -33,27 +33,187 @@ Output: [0,1]
 - -10^9 <= target <= 10^9
 - Only one valid answer exists
 
-⏰ TIME COMPLEXITY: O(n)
+⏰ TIME COMPLEXITY: O(n) per query, O(n) index build for twoSumMany
 💾 SPACE COMPLEXITY: O(n)
 */
 
+class FlatIntMap {
+public:
+    explicit FlatIntMap(int capacityHint = 8) {
+        reserve(capacityHint);
+    }
+
+    void reserve(int n) {
+
+        int bits = 3;
+
+        while ((1 << bits) < 2 * n) {
+            bits++;
+        }
+
+        if ((int)keys.size() >= (1 << bits)) {
+            return;
+        }
+
+        rehash(bits);
+    }
+
+    void clear() {
+        fill(keys.begin(), keys.end(), EMPTY);
+        count = 0;
+        hasEmptyKey = false;
+    }
+
+    int size() const {
+        return count + (hasEmptyKey ? 1 : 0);
+    }
+
+    const int* find(int key) const {
+
+        if (key == EMPTY) {
+            return hasEmptyKey ? &emptyKeyValue : nullptr;
+        }
+
+        const int* k = keys.data();
+
+        for (unsigned i = slot(key); ; i = (i + 1) & mask) {
+
+            if (k[i] == key) {
+                return &vals[i];
+            }
+
+            if (k[i] == EMPTY) {
+                return nullptr;
+            }
+        }
+    }
+
+    void insert_or_assign(int key, int value) {
+
+        if (key == EMPTY) {
+            hasEmptyKey = true;
+            emptyKeyValue = value;
+            return;
+        }
+
+        if (2 * (count + 1) > (int)keys.size()) {
+            rehash(shiftBits + 1);
+        }
+
+        for (unsigned i = slot(key); ; i = (i + 1) & mask) {
+
+            if (keys[i] == key) {
+                vals[i] = value;
+                return;
+            }
+
+            if (keys[i] == EMPTY) {
+                keys[i] = key;
+                vals[i] = value;
+                count++;
+                return;
+            }
+        }
+    }
+
+private:
+    static constexpr int EMPTY = INT_MIN;
+
+    // Keys and values live in separate contiguous arrays so a probe run
+    // only touches key cache lines and can be compared a vector at a time.
+    vector<int> keys;
+    vector<int> vals;
+
+    unsigned mask = 0;
+    int shiftBits = 0;
+    int count = 0;
+
+    bool hasEmptyKey = false;
+    int emptyKeyValue = 0;
+
+    unsigned slot(int key) const {
+        uint64_t h = (uint64_t)(uint32_t)key * 0x9E3779B97F4A7C15ull;
+        return (unsigned)(h >> (64 - shiftBits));
+    }
+
+    void rehash(int bits) {
+
+        vector<int> oldKeys = move(keys);
+        vector<int> oldVals = move(vals);
+
+        keys.assign(1u << bits, EMPTY);
+        vals.assign(1u << bits, 0);
+        mask = (1u << bits) - 1;
+        shiftBits = bits;
+        count = 0;
+
+        for (size_t i = 0; i < oldKeys.size(); i++) {
+            if (oldKeys[i] != EMPTY) {
+                insert_or_assign(oldKeys[i], oldVals[i]);
+            }
+        }
+    }
+};
+
 class Solution {
 public:
     vector<int> twoSum(vector<int>& nums, int target) {
 
-        unordered_map<int, int> mp;
+        FlatIntMap mp(nums.size());
 
         for (int i = 0; i < nums.size(); i++) {
 
             int value = target - nums[i];
 
-            if (mp.find(value) != mp.end()) {
-                return {mp[value], i};
+            if (const int* j = mp.find(value)) {
+                return {*j, i};
             }
 
-            mp[nums[i]] = i;
+            mp.insert_or_assign(nums[i], i);
         }
 
         return {};
     }
+
+    // Answers many targets against the same array. The value -> last index
+    // map is built once; each target is then a single scan with O(1) probes.
+    // A pair {-1, -1} marks a target that has no solution.
+    vector<vector<int>> twoSumMany(vector<int>& nums, vector<int>& targets) {
+
+        int n = nums.size();
+
+        FlatIntMap last(n);
+
+        for (int i = 0; i < n; i++) {
+            last.insert_or_assign(nums[i], i);
+        }
+
+        vector<vector<int>> result;
+        result.reserve(targets.size());
+
+        for (int target : targets) {
+
+            vector<int> pair = {-1, -1};
+
+            for (int i = 0; i < n; i++) {
+
+                long long value = (long long)target - nums[i];
+
+                if (value < INT_MIN || value > INT_MAX) {
+                    continue;
+                }
+
+                const int* j = last.find((int)value);
+
+                if (j != nullptr && *j != i) {
+                    pair = {min(i, *j), max(i, *j)};
+                    break;
+                }
+            }
+
+            result.push_back(pair);
+        }
+
+        return result;
+    }
 };
\ No newline at end of file
@@ -26,10 +26,176 @@ Output: [3,4,6,16,17]
 - 1 <= nums.length <= 1000
 - -10^6 <= nums[i] <= 10^6
 
-⏰ TIME COMPLEXITY: O(n)
-💾 SPACE COMPLEXITY: O(1)
+⏰ TIME COMPLEXITY: O(n) [O(n / p) span with p threads]
+💾 SPACE COMPLEXITY: O(1) in place, O(p) block sums
 */
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PREFIX_SCAN_X86 1
+#endif
+
+// Inclusive prefix sum from T into a wider accumulator type Acc
+// (e.g. int -> long long so large inputs cannot overflow). out may alias
+// in, or point to any caller-supplied buffer of n elements.
+//
+// int -> long long and double -> double use a 4-lane AVX2 in-register scan
+// when the CPU supports it. For double this adds within each group of four
+// before adding the carry, so results can differ from the scalar loop in
+// the last bits.
+//
+// Large inputs use a two-pass blocked scan: every thread sums its block,
+// the block sums are scanned serially, then every thread rescans its block
+// starting from its offset.
+template <class Acc>
+class PrefixScan {
+public:
+    template <class T>
+    static Acc scan(const T* in, Acc* out, size_t n, Acc carry = Acc()) {
+#ifdef PREFIX_SCAN_X86
+        if constexpr ((is_same_v<T, int> && is_same_v<Acc, long long>) ||
+                      (is_same_v<T, double> && is_same_v<Acc, double>)) {
+            if (hasAvx2()) {
+                return scanAvx2(in, out, n, carry);
+            }
+        }
+#endif
+        return scanScalar(in, out, n, carry);
+    }
+
+    template <class T>
+    static void parallelScan(const T* in, Acc* out, size_t n, int threads = 0) {
+
+        if (threads <= 0) {
+            threads = n < (1 << 20) ? 1 : max(1u, thread::hardware_concurrency());
+        }
+
+        if (threads == 1) {
+            scan(in, out, n);
+            return;
+        }
+
+        size_t chunk = (n + threads - 1) / threads;
+
+        vector<Acc> offset(threads + 1, Acc());
+
+        runThreads(threads, [&](int t) {
+
+            size_t lo = min(n, t * chunk);
+            size_t hi = min(n, lo + chunk);
+
+            Acc sum = Acc();
+
+            for (size_t i = lo; i < hi; i++) {
+                sum += in[i];
+            }
+
+            offset[t + 1] = sum;
+        });
+
+        for (int t = 0; t < threads; t++) {
+            offset[t + 1] += offset[t];
+        }
+
+        runThreads(threads, [&](int t) {
+            size_t lo = min(n, t * chunk);
+            size_t hi = min(n, lo + chunk);
+            scan(in + lo, out + lo, hi - lo, offset[t]);
+        });
+    }
+
+private:
+    template <class T>
+    static Acc scanScalar(const T* in, Acc* out, size_t n, Acc carry) {
+
+        for (size_t i = 0; i < n; i++) {
+            carry += in[i];
+            out[i] = carry;
+        }
+
+        return carry;
+    }
+
+    template <class Task>
+    static void runThreads(int threads, Task&& task) {
+
+        vector<thread> pool;
+
+        for (int t = 1; t < threads; t++) {
+            pool.emplace_back(task, t);
+        }
+
+        task(0);
+
+        for (thread& th : pool) {
+            th.join();
+        }
+    }
+
+#ifdef PREFIX_SCAN_X86
+    static bool hasAvx2() {
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+    }
+
+    __attribute__((target("avx2")))
+    static long long scanAvx2(const int* in, long long* out, size_t n, long long carry) {
+
+        const __m256i zero = _mm256_setzero_si256();
+
+        __m256i c = _mm256_set1_epi64x(carry);
+
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4) {
+
+            __m128i raw = _mm_loadu_si128((const __m128i*)(in + i));
+            __m256i x = _mm256_cvtepi32_epi64(raw);
+
+            // [a b c d] -> [a a+b b+c c+d] -> [a a+b a+b+c a+b+c+d]
+            x = _mm256_add_epi64(x, _mm256_blend_epi32(_mm256_permute4x64_epi64(x, 0x90), zero, 0x03));
+            x = _mm256_add_epi64(x, _mm256_blend_epi32(_mm256_permute4x64_epi64(x, 0x40), zero, 0x0F));
+            x = _mm256_add_epi64(x, c);
+
+            _mm256_storeu_si256((__m256i*)(out + i), x);
+
+            c = _mm256_permute4x64_epi64(x, 0xFF);
+        }
+
+        carry = _mm256_extract_epi64(c, 0);
+
+        return scanScalar(in + i, out + i, n - i, carry);
+    }
+
+    __attribute__((target("avx2")))
+    static double scanAvx2(const double* in, double* out, size_t n, double carry) {
+
+        const __m256d zero = _mm256_setzero_pd();
+
+        __m256d c = _mm256_set1_pd(carry);
+
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4) {
+
+            __m256d x = _mm256_loadu_pd(in + i);
+
+            x = _mm256_add_pd(x, _mm256_blend_pd(_mm256_permute4x64_pd(x, 0x90), zero, 0x1));
+            x = _mm256_add_pd(x, _mm256_blend_pd(_mm256_permute4x64_pd(x, 0x40), zero, 0x3));
+            x = _mm256_add_pd(x, c);
+
+            _mm256_storeu_pd(out + i, x);
+
+            c = _mm256_permute4x64_pd(x, 0xFF);
+        }
+
+        carry = _mm256_cvtsd_f64(c);
+
+        return scanScalar(in + i, out + i, n - i, carry);
+    }
+#endif
+};
+
 class Solution {
 public:
     vector<int> runningSum(vector<int>& nums) {
@@ -43,4 +209,14 @@ public:
 
         return nums;
     }
+
+    // Same result with 64-bit sums, for inputs whose totals exceed int.
+    vector<long long> runningSumWide(const vector<int>& nums) {
+
+        vector<long long> out(nums.size());
+
+        PrefixScan<long long>::parallelScan(nums.data(), out.data(), nums.size());
+
+        return out;
+    }
 };
\ No newline at end of file
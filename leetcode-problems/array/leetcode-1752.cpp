@@ -29,32 +29,215 @@ Output: true
 - 1 <= nums.length <= 100
 - 1 <= nums[i] <= 100
 
-⏰ TIME COMPLEXITY: O(n)
+⏰ TIME COMPLEXITY: O(n), stops at the second descent
 💾 SPACE COMPLEXITY: O(1)
 */
 
-class Solution {
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ROTATION_CHECK_X86 1
+#endif
+
+struct RotationInfo {
+    bool sortedRotated = false;
+    // Index where the non-decreasing order starts, i.e. rotating the
+    // array left by offset sorts it. Only meaningful if sortedRotated.
+    size_t offset = 0;
+};
+
+// Counts descents a[i] > a[i + 1] and stops as soon as a second one is
+// seen: a sorted array rotated by any amount has at most one descent,
+// counting the wrap-around pair (a[n - 1], a[0]).
+template <class T>
+class RotationCheck {
 public:
-    bool check(vector<int>& nums) {
+    static RotationInfo run(const T* a, size_t n, int threads = 0) {
+
+        RotationInfo info;
+
+        if (n <= 1) {
+            info.sortedRotated = true;
+            return info;
+        }
+
+        if (threads <= 0) {
+            threads = n < 10000000 ? 1 : max(1u, thread::hardware_concurrency());
+        }
+
+        size_t pairs = n - 1;
+        size_t chunk = (pairs + threads - 1) / threads;
+
+        vector<size_t> first(threads, SIZE_MAX);
+        vector<int> count(threads, 0);
+
+        atomic<int> total(0);
+
+        auto work = [&](int t) {
+
+            size_t lo = min(pairs, t * chunk);
+            size_t hi = min(pairs, lo + chunk);
+
+            count[t] = countDescents(a, lo, hi, first[t], total);
+        };
+
+        if (threads == 1) {
+            work(0);
+        }
+        else {
+
+            vector<thread> pool;
+
+            for (int t = 1; t < threads; t++) {
+                pool.emplace_back(work, t);
+            }
+
+            work(0);
+
+            for (thread& th : pool) {
+                th.join();
+            }
+        }
+
+        int descents = 0;
+        size_t firstDescent = SIZE_MAX;
+
+        for (int t = 0; t < threads; t++) {
+            descents += count[t];
+            firstDescent = min(firstDescent, first[t]);
+        }
+
+        if (a[n - 1] > a[0]) {
+            descents++;
+        }
+
+        info.sortedRotated = descents <= 1;
+        info.offset = firstDescent == SIZE_MAX ? 0 : firstDescent + 1;
+
+        return info;
+    }
+
+private:
+    // Pairs (i, i + 1) for i in [lo, hi). total is shared by all threads so
+    // every scanner stops once the array as a whole has two descents.
+    static int countDescents(const T* a, size_t lo, size_t hi, size_t& first, atomic<int>& total) {
+
+        const size_t STEP = 4096;
+
+        int found = 0;
+
+        for (size_t i = lo; i < hi; i += STEP) {
+
+            size_t end = min(hi, i + STEP);
 
-        int n = nums.size();
-        int count = 0;
+            int c = countBlock(a, i, end, first);
 
-        for (int i = 0; i < n - 1; i++) {
+            if (c > 0) {
+                found += c;
 
-            if (nums[i] > nums[i + 1]) {
-                count++;
+                if (total.fetch_add(c) + c > 1) {
+                    return found;
+                }
+            }
+            else if (total.load(memory_order_relaxed) > 1) {
+                return found;
             }
         }
 
-        if (nums[n - 1] > nums[0]) {
-            count++;
+        return found;
+    }
+
+    static int countBlock(const T* a, size_t lo, size_t hi, size_t& first) {
+#ifdef ROTATION_CHECK_X86
+        if constexpr (is_same_v<T, int> || is_same_v<T, long long> || is_same_v<T, float>) {
+
+            static const bool avx2 = __builtin_cpu_supports("avx2");
+
+            if (avx2) {
+                return countBlockAvx2(a, lo, hi, first);
+            }
         }
+#endif
+        return countBlockScalar(a, lo, hi, first);
+    }
+
+    static int countBlockScalar(const T* a, size_t lo, size_t hi, size_t& first) {
+
+        int c = 0;
+
+        for (size_t i = lo; i < hi; i++) {
 
-        if (count == 0 || count == 1) {
-            return true;
+            if (a[i] > a[i + 1]) {
+
+                first = min(first, i);
+
+                if (++c > 1) {
+                    break;
+                }
+            }
         }
 
-        return false;
+        return c;
+    }
+
+#ifdef ROTATION_CHECK_X86
+    // One mask bit per lane where a[i] > a[i + 1], from two overlapping
+    // unaligned loads.
+    __attribute__((target("avx2")))
+    static unsigned descentMask(const T* p) {
+
+        if constexpr (is_same_v<T, int>) {
+            __m256i x = _mm256_loadu_si256((const __m256i*)p);
+            __m256i y = _mm256_loadu_si256((const __m256i*)(p + 1));
+            return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, y)));
+        }
+        else if constexpr (is_same_v<T, long long>) {
+            __m256i x = _mm256_loadu_si256((const __m256i*)p);
+            __m256i y = _mm256_loadu_si256((const __m256i*)(p + 1));
+            return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(x, y)));
+        }
+        else {
+            __m256 x = _mm256_loadu_ps(p);
+            __m256 y = _mm256_loadu_ps(p + 1);
+            return _mm256_movemask_ps(_mm256_cmp_ps(x, y, _CMP_GT_OQ));
+        }
+    }
+
+    __attribute__((target("avx2")))
+    static int countBlockAvx2(const T* a, size_t lo, size_t hi, size_t& first) {
+
+        const size_t W = 32 / sizeof(T);
+
+        int c = 0;
+        size_t i = lo;
+
+        for (; i + W <= hi; i += W) {
+
+            unsigned mask = descentMask(a + i);
+
+            if (mask != 0) {
+
+                first = min(first, i + __builtin_ctz(mask));
+                c += __builtin_popcount(mask);
+
+                if (c > 1) {
+                    return c;
+                }
+            }
+        }
+
+        return c + countBlockScalar(a, i, hi, first);
+    }
+#endif
+};
+
+template <class T>
+RotationInfo is_sorted_rotated(const T* a, size_t n, int threads = 0) {
+    return RotationCheck<T>::run(a, n, threads);
+}
+
+class Solution {
+public:
+    bool check(vector<int>& nums) {
+        return is_sorted_rotated(nums.data(), nums.size()).sortedRotated;
     }
 };
\ No newline at end of file
@@ -0,0 +1,276 @@
+/*
+╔══════════════════════════════════════════════════════════════════════════════╗
+║                          LEETCODE PROBLEM SOLUTION                           ║
+╠══════════════════════════════════════════════════════════════════════════════╣
+║ Problem ID    : 2141                                                         ║
+║ Problem Name  : Maximum Running Time of N Computers                          ║
+║ Difficulty    : Hard                                                         ║
+║ Topic         : Array, Sorting, Greedy, Balanced BST                         ║
+╚══════════════════════════════════════════════════════════════════════════════╝
+
+📋 PROBLEM STATEMENT:
+You have n computers and batteries array where batteries[i] can run a computer
+for batteries[i] minutes. You can swap batteries freely.
+
+Return maximum time all n computers can run simultaneously.
+
+📋 IDEA:
+- Sort batteries in decreasing order, let S be the total
+- A battery larger than the current average S / n can never be fully used;
+  it powers one computer on its own, so drop it and solve for n - 1
+- Once the largest remaining battery is <= the average, the average is
+  the answer
+- Once the test passes, every further battery is <= the average and
+  dropping it cannot lower the average, so the test is monotone in the
+  number k of dropped batteries; BatteryFleet finds the first passing k
+  with one tree descent
+
+⏰ TIME COMPLEXITY: O(m log m) for maxRunTime; O(log m) expected per
+                   BatteryFleet update or query
+💾 SPACE COMPLEXITY: O(1) extra after sorting; O(distinct capacities) for BatteryFleet
+*/
+
+// Multiset of battery capacities for a fixed number of computers. A treap
+// keyed by capacity keeps per-subtree count and sum, so the answer is
+// found in a single root-to-leaf descent, largest capacities first.
+class BatteryFleet {
+public:
+    explicit BatteryFleet(int computers) : n(computers) {}
+
+    void addBattery(long long capacity) {
+        root = insert(root, capacity);
+    }
+
+    // Returns false if no battery with this capacity is present.
+    bool removeBattery(long long capacity) {
+
+        bool removed = false;
+
+        root = erase(root, capacity, removed);
+
+        return removed;
+    }
+
+    long long maxRunTime() const {
+
+        if (n <= 0 || count(root) < n) {
+            return 0;
+        }
+
+        long long total = sum(root);
+
+        // Smallest k (batteries dropped from the top) such that the next
+        // largest capacity x satisfies x * (n - k) <= total - top_k. Every
+        // copy of x gives the same test, so only value boundaries are tried.
+        long long bestK = -1;
+        long long bestTop = 0;
+
+        long long k = 0;
+        long long top = 0;
+
+        for (int v = root; v != NIL; ) {
+
+            const Node& node = pool[v];
+
+            long long k0 = k + count(node.right);
+            long long top0 = top + sum(node.right);
+
+            // k0 >= n cannot be the answer (k <= n - 1 always passes), so
+            // look among larger capacities.
+            bool passes = k0 < n && (__int128)node.value * (n - k0) <= total - top0;
+
+            if (k0 >= n || passes) {
+
+                if (passes) {
+                    bestK = k0;
+                    bestTop = top0;
+                }
+
+                v = node.right;
+            }
+            else {
+                k = k0 + node.copies;
+                top = top0 + node.copies * node.value;
+                v = node.left;
+            }
+        }
+
+        return (total - bestTop) / (n - bestK);
+    }
+
+private:
+    static const int NIL = -1;
+
+    struct Node {
+        long long value;
+        long long copies;
+        long long count;
+        long long sum;
+        uint32_t priority;
+        int left;
+        int right;
+    };
+
+    int n;
+    int root = NIL;
+
+    vector<Node> pool;
+    vector<int> freeSlots;
+
+    mt19937 rng{0x2141};
+
+    long long count(int v) const {
+        return v == NIL ? 0 : pool[v].count;
+    }
+
+    long long sum(int v) const {
+        return v == NIL ? 0 : pool[v].sum;
+    }
+
+    void pull(int v) {
+        Node& node = pool[v];
+        node.count = node.copies + count(node.left) + count(node.right);
+        node.sum = node.copies * node.value + sum(node.left) + sum(node.right);
+    }
+
+    int rotateRight(int v) {
+        int l = pool[v].left;
+        pool[v].left = pool[l].right;
+        pool[l].right = v;
+        pull(v);
+        pull(l);
+        return l;
+    }
+
+    int rotateLeft(int v) {
+        int r = pool[v].right;
+        pool[v].right = pool[r].left;
+        pool[r].left = v;
+        pull(v);
+        pull(r);
+        return r;
+    }
+
+    int insert(int v, long long value) {
+
+        if (v == NIL) {
+
+            int slot;
+
+            if (!freeSlots.empty()) {
+                slot = freeSlots.back();
+                freeSlots.pop_back();
+            }
+            else {
+                slot = pool.size();
+                pool.emplace_back();
+            }
+
+            pool[slot] = {value, 1, 1, value, (uint32_t)rng(), NIL, NIL};
+
+            return slot;
+        }
+
+        if (value == pool[v].value) {
+            pool[v].copies++;
+        }
+        else if (value < pool[v].value) {
+
+            int child = insert(pool[v].left, value);
+            pool[v].left = child;
+
+            if (pool[child].priority > pool[v].priority) {
+                return rotateRight(v);
+            }
+        }
+        else {
+
+            int child = insert(pool[v].right, value);
+            pool[v].right = child;
+
+            if (pool[child].priority > pool[v].priority) {
+                return rotateLeft(v);
+            }
+        }
+
+        pull(v);
+
+        return v;
+    }
+
+    int erase(int v, long long value, bool& removed) {
+
+        if (v == NIL) {
+            return NIL;
+        }
+
+        if (value < pool[v].value) {
+            pool[v].left = erase(pool[v].left, value, removed);
+        }
+        else if (value > pool[v].value) {
+            pool[v].right = erase(pool[v].right, value, removed);
+        }
+        else {
+
+            removed = true;
+
+            if (pool[v].copies > 1) {
+                pool[v].copies--;
+            }
+            else {
+
+                int merged = merge(pool[v].left, pool[v].right);
+
+                freeSlots.push_back(v);
+
+                return merged;
+            }
+        }
+
+        pull(v);
+
+        return v;
+    }
+
+    // All values in a are smaller than all values in b.
+    int merge(int a, int b) {
+
+        if (a == NIL) return b;
+        if (b == NIL) return a;
+
+        if (pool[a].priority > pool[b].priority) {
+            pool[a].right = merge(pool[a].right, b);
+            pull(a);
+            return a;
+        }
+
+        pool[b].left = merge(a, pool[b].left);
+        pull(b);
+
+        return b;
+    }
+};
+
+class Solution {
+public:
+    long long maxRunTime(int n, vector<int>& batteries) {
+
+        sort(batteries.begin(), batteries.end(), greater<int>());
+
+        long long total = 0;
+
+        for (int b : batteries) {
+            total += b;
+        }
+
+        // Batteries above the running average each serve one computer.
+        int k = 0;
+
+        while (batteries[k] > total / (n - k)) {
+            total -= batteries[k];
+            k++;
+        }
+
+        return total / (n - k);
+    }
+};
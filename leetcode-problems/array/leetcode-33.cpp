@@ -38,10 +38,83 @@ Output: -1
 - nums is sorted and possibly rotated
 - -10^4 <= target <= 10^4
 
-⏰ TIME COMPLEXITY: O(log n)
-💾 SPACE COMPLEXITY: O(1)
+⏰ TIME COMPLEXITY: O(log n) per query, O(n) to prepare an index
+💾 SPACE COMPLEXITY: O(1), O(n) for RotatedArrayIndex
 */
 
+#include "eytzinger-search.h"
+
+// Prepared form of a rotated array for answering many lookups. The pivot
+// is found once, the keys are un-rotated into sorted order and searched
+// through an Eytzinger layout; hits are mapped back to rotated indices.
+class RotatedArrayIndex {
+public:
+    explicit RotatedArrayIndex(const vector<int>& nums) : nums(nums) {
+
+        int n = nums.size();
+
+        int left = 0;
+        int right = n - 1;
+
+        while (left < right) {
+
+            int mid = left + (right - left) / 2;
+
+            if (nums[mid] > nums[right]) {
+                left = mid + 1;
+            }
+            else {
+                right = mid;
+            }
+        }
+
+        pivot = left;
+
+        vector<int> sorted(n);
+
+        for (int i = 0; i < n; i++) {
+            sorted[i] = nums[(i + pivot) % n];
+        }
+
+        tree = EytzingerSearch(sorted);
+    }
+
+    int search(int target) const {
+        return toIndex(tree.lowerBound(target), target);
+    }
+
+    vector<int> searchBatch(const vector<int>& targets) const {
+
+        vector<int> result(targets.size());
+
+        tree.lowerBoundBatch(targets.data(), result.data(), targets.size());
+
+        for (size_t i = 0; i < targets.size(); i++) {
+            result[i] = toIndex(result[i], targets[i]);
+        }
+
+        return result;
+    }
+
+private:
+    vector<int> nums;
+    int pivot = 0;
+    EytzingerSearch tree;
+
+    int toIndex(int sortedPos, int target) const {
+
+        int n = nums.size();
+
+        if (sortedPos == n) {
+            return -1;
+        }
+
+        int idx = (sortedPos + pivot) % n;
+
+        return nums[idx] == target ? idx : -1;
+    }
+};
+
 class Solution {
 public:
     int search(vector<int>& nums, int target) {
@@ -80,4 +153,52 @@ public:
 
         return -1;
     }
-};
\ No newline at end of file
+};
+
+// Batched RotatedArrayIndex against one search call per target, on the
+// same rotated array and queries (about half of them misses).
+void benchmarkRotatedArrayIndex(int n = 1 << 20, int queries = 1 << 22) {
+
+    mt19937 rng(42);
+
+    vector<int> nums(n);
+    int pivot = rng() % n;
+
+    for (int i = 0; i < n; i++) {
+        nums[i] = 2 * ((i + pivot) % n);
+    }
+
+    vector<int> targets(queries);
+
+    for (int& t : targets) {
+        t = rng() % (2 * n);
+    }
+
+    Solution solution;
+
+    auto t0 = chrono::steady_clock::now();
+
+    vector<int> perCall(queries);
+
+    for (int i = 0; i < queries; i++) {
+        perCall[i] = solution.search(nums, targets[i]);
+    }
+
+    auto t1 = chrono::steady_clock::now();
+
+    RotatedArrayIndex index(nums);
+
+    auto t2 = chrono::steady_clock::now();
+
+    vector<int> batched = index.searchBatch(targets);
+
+    auto t3 = chrono::steady_clock::now();
+
+    double perCallMs = chrono::duration<double, milli>(t1 - t0).count();
+    double buildMs = chrono::duration<double, milli>(t2 - t1).count();
+    double batchMs = chrono::duration<double, milli>(t3 - t2).count();
+
+    printf("per-call=%.1fms  build=%.1fms  batched=%.1fms  speedup=%.2fx  %s\n",
+           perCallMs, buildMs, batchMs, perCallMs / batchMs,
+           perCall == batched ? "ok" : "MISMATCH");
+}
\ No newline at end of file
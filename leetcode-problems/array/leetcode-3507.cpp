@@ -41,42 +41,124 @@ Array is already non-decreasing.
 - 1 <= nums.length <= 50
 - -1000 <= nums[i] <= 1000
 
-⏰ TIME COMPLEXITY: O(n²)
-💾 SPACE COMPLEXITY: O(1) (excluding array modification)
+⏰ TIME COMPLEXITY: O(n log n) per full query, O(k log n) per append of k
+💾 SPACE COMPLEXITY: O(n)
 */
 
-class Solution {
+// Stateful solver for arrays that grow over time. append() keeps the
+// neighbour inversion count and the ordered set of adjacent pair sums up
+// to date in O(k log n), so a query on a sorted array, or a repeated query
+// with no appends in between, is O(1). Once the array holds an inversion
+// the merge order can depend on every element, so the simulation is
+// replayed from the maintained state.
+class PairRemovalSolver {
 public:
-    bool isSorted(vector<int>& nums) {
-        for (int i = 1; i < nums.size(); i++) {
-            if (nums[i] < nums[i - 1])
-                return false;
+    void append(span<const int> values) {
+
+        for (int v : values) {
+
+            int i = a.size();
+
+            if (i > 0) {
+
+                if (a[i - 1] > v)
+                    inversions++;
+
+                sums.insert({a[i - 1] + v, i - 1});
+            }
+
+            a.push_back(v);
         }
-        return true;
+
+        if (!values.empty())
+            cached = -1;
     }
 
-    int minimumPairRemoval(vector<int>& nums) {
+    int size() const {
+        return a.size();
+    }
+
+    int query() {
+
+        if (inversions == 0)
+            return 0;
+
+        if (cached == -1)
+            cached = simulate();
+
+        return cached;
+    }
+
+private:
+    vector<long long> a;
+    set<pair<long long, int>> sums;
+
+    int inversions = 0;
+    int cached = -1;
+
+    int simulate() const {
+
+        int n = a.size();
+
+        vector<long long> val = a;
+        vector<int> prev(n), next(n);
+
+        for (int i = 0; i < n; i++) {
+            prev[i] = i - 1;
+            next[i] = i + 1;
+        }
+
+        next[n - 1] = -1;
+
+        set<pair<long long, int>> pq = sums;
+
+        int bad = inversions;
         int operations = 0;
 
-        while (!isSorted(nums)) {
-            int minSum = INT_MAX;
-            int idx = 0;
+        while (bad > 0) {
 
-            for (int i = 0; i < nums.size() - 1; i++) {
-                int sum = nums[i] + nums[i + 1];
+            auto [sum, i] = *pq.begin();
+            pq.erase(pq.begin());
 
-                if (sum < minSum) {
-                    minSum = sum;
-                    idx = i;
-                }
-            }
+            int j = next[i];
+            int pi = prev[i];
+            int nj = next[j];
+
+            if (pi != -1) pq.erase({val[pi] + val[i], pi});
+            if (nj != -1) pq.erase({val[j] + val[nj], j});
+
+            if (pi != -1 && val[pi] > val[i]) bad--;
+            if (val[i] > val[j]) bad--;
+            if (nj != -1 && val[j] > val[nj]) bad--;
+
+            val[i] = sum;
+
+            next[i] = nj;
 
-            nums[idx] = nums[idx] + nums[idx + 1];
-            nums.erase(nums.begin() + idx + 1);
+            if (nj != -1)
+                prev[nj] = i;
+
+            if (pi != -1 && val[pi] > val[i]) bad++;
+            if (nj != -1 && val[i] > val[nj]) bad++;
+
+            if (pi != -1) pq.insert({val[pi] + val[i], pi});
+            if (nj != -1) pq.insert({val[i] + val[nj], i});
 
             operations++;
         }
 
         return operations;
     }
+};
+
+class Solution {
+public:
+    int minimumPairRemoval(vector<int>& nums) {
+
+        PairRemovalSolver solver;
+
+        solver.append(nums);
+
+        return solver.query();
+    }
 };
\ No newline at end of file
@@ -0,0 +1,35 @@
+/*
+╔══════════════════════════════════════════════════════════════════════════════╗
+║                          LEETCODE PROBLEM SOLUTION                           ║
+╠══════════════════════════════════════════════════════════════════════════════╣
+║ Problem ID    : 3623                                                         ║
+║ Problem Name  : Count Number of Trapezoids I                                 ║
+║ Difficulty    : Medium                                                       ║
+║ Topic         : Array, Radix Sort, Math, Combinatorics                       ║
+╚══════════════════════════════════════════════════════════════════════════════╝
+
+📋 PROBLEM STATEMENT:
+Given points in 2D plane, count number of horizontal trapezoids.
+
+A horizontal trapezoid needs at least one pair of horizontal sides
+(points on same y-coordinate form a horizontal segment).
+
+Return result modulo 1e9+7.
+
+📋 IDEA:
+- Radix sort the y-coordinates so equal rows become contiguous runs
+- A run of cnt points gives C(cnt, 2) horizontal segments
+- Any two segments from different rows form a trapezoid
+
+⏰ TIME COMPLEXITY: O(n)
+💾 SPACE COMPLEXITY: O(n)
+*/
+
+#include "trapezoid-counter.h"
+
+class Solution {
+public:
+    int countTrapezoids(vector<vector<int>>& points) {
+        return TrapezoidCounter::countHorizontal(points);
+    }
+};
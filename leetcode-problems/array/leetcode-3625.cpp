@@ -0,0 +1,48 @@
+/*
+╔══════════════════════════════════════════════════════════════════════════════╗
+║                          LEETCODE PROBLEM SOLUTION                           ║
+╠══════════════════════════════════════════════════════════════════════════════╣
+║ Problem ID    : 3625                                                         ║
+║ Problem Name  : Count Number of Trapezoids II                                ║
+║ Difficulty    : Hard                                                         ║
+║ Topic         : Geometry, Radix Sort, Math, Combinatorics                    ║
+╚══════════════════════════════════════════════════════════════════════════════╝
+
+📋 PROBLEM STATEMENT:
+Given distinct points on a 2D plane, return the number of unique
+trapezoids that can be formed by choosing any four of them.
+
+A trapezoid is a convex quadrilateral with at least one pair of
+parallel sides.
+
+📝 EXAMPLES:
+Input: points = [[-3,2],[3,0],[2,3],[3,2],[2,-3]]
+Output: 2
+
+Input: points = [[0,0],[1,0],[0,1],[2,1]]
+Output: 1
+
+🎯 CONSTRAINTS:
+- 4 <= points.length <= 500
+- -1000 <= xi, yi <= 1000
+- All points are pairwise distinct
+
+📋 IDEA:
+- Pair every two points into a segment, keyed by (direction, line)
+  and by (midpoint, direction), packed into 64-bit integers
+- Radix sort both key arrays and sweep them once
+- Parallel segments on different lines give trapezoids; parallelograms
+  are counted twice and are removed via their shared-midpoint diagonals
+
+⏰ TIME COMPLEXITY: O(n^2)
+💾 SPACE COMPLEXITY: O(n^2)
+*/
+
+#include "trapezoid-counter.h"
+
+class Solution {
+public:
+    int countTrapezoids(vector<vector<int>>& points) {
+        return (int)TrapezoidCounter::countAll(points);
+    }
+};
@@ -33,10 +33,52 @@ Output: false
 - 1 <= m, n <= 100
 - -10^4 <= matrix[i][j], target <= 10^4
 
-⏰ TIME COMPLEXITY: O(log(m * n))
-💾 SPACE COMPLEXITY: O(1)
+⏰ TIME COMPLEXITY: O(log(m * n)) per query, O(m * n) to prepare an index
+💾 SPACE COMPLEXITY: O(1), O(m * n) for SortedMatrixIndex
 */
 
+#include "eytzinger-search.h"
+
+// Prepared form of a sorted matrix for answering many lookups: the matrix
+// is flattened once and searched through an Eytzinger layout.
+class SortedMatrixIndex {
+public:
+    explicit SortedMatrixIndex(const vector<vector<int>>& matrix) {
+
+        for (const vector<int>& row : matrix) {
+            flat.insert(flat.end(), row.begin(), row.end());
+        }
+
+        tree = EytzingerSearch(flat);
+    }
+
+    bool contains(int target) const {
+
+        int pos = tree.lowerBound(target);
+
+        return pos < (int)flat.size() && flat[pos] == target;
+    }
+
+    vector<bool> containsBatch(const vector<int>& targets) const {
+
+        vector<int> pos(targets.size());
+
+        tree.lowerBoundBatch(targets.data(), pos.data(), targets.size());
+
+        vector<bool> result(targets.size());
+
+        for (size_t i = 0; i < targets.size(); i++) {
+            result[i] = pos[i] < (int)flat.size() && flat[pos[i]] == targets[i];
+        }
+
+        return result;
+    }
+
+private:
+    vector<int> flat;
+    EytzingerSearch tree;
+};
+
 class Solution {
 public:
     bool searchMatrix(vector<vector<int>>& matrix, int target) {
@@ -69,4 +111,53 @@ public:
 
         return false;
     }
-};
\ No newline at end of file
+};
+
+// Batched SortedMatrixIndex against one searchMatrix call per target, on
+// the same matrix and queries (about half of them misses).
+void benchmarkSortedMatrixIndex(int rows = 1000, int cols = 1000, int queries = 1 << 22) {
+
+    mt19937 rng(42);
+
+    vector<vector<int>> matrix(rows, vector<int>(cols));
+
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            matrix[r][c] = 2 * (r * cols + c);
+        }
+    }
+
+    vector<int> targets(queries);
+
+    for (int& t : targets) {
+        t = rng() % (2 * rows * cols);
+    }
+
+    Solution solution;
+
+    auto t0 = chrono::steady_clock::now();
+
+    vector<bool> perCall(queries);
+
+    for (int i = 0; i < queries; i++) {
+        perCall[i] = solution.searchMatrix(matrix, targets[i]);
+    }
+
+    auto t1 = chrono::steady_clock::now();
+
+    SortedMatrixIndex index(matrix);
+
+    auto t2 = chrono::steady_clock::now();
+
+    vector<bool> batched = index.containsBatch(targets);
+
+    auto t3 = chrono::steady_clock::now();
+
+    double perCallMs = chrono::duration<double, milli>(t1 - t0).count();
+    double buildMs = chrono::duration<double, milli>(t2 - t1).count();
+    double batchMs = chrono::duration<double, milli>(t3 - t2).count();
+
+    printf("per-call=%.1fms  build=%.1fms  batched=%.1fms  speedup=%.2fx  %s\n",
+           perCallMs, buildMs, batchMs, perCallMs / batchMs,
+           perCall == batched ? "ok" : "MISMATCH");
+}
\ No newline at end of file
@@ -32,13 +32,224 @@ Output: [0,1,2]
 - 1 <= n <= 300
 - nums[i] is either 0, 1, or 2
 
-⏰ TIME COMPLEXITY: O(n)
-💾 SPACE COMPLEXITY: O(1)
+⏰ TIME COMPLEXITY: O(n) [counting pass + fill, AVX2 when available]
+💾 SPACE COMPLEXITY: O(k · threads) for the histograms
 */
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SMALL_INT_SORT_X86 1
+#endif
+
+// Counting sort for arrays whose values lie in [0, k).
+// A histogram pass is followed by one fill per class; for small k both
+// passes are branch-free and run on AVX2 when the CPU has it. Large inputs
+// split the histogram and the fill across threads.
+//
+// The histogram has an extra slot k that counts values outside [0, k). If
+// it is non-zero after the count pass, sort() throws out_of_range before
+// anything is written, so nums is left unchanged.
+class SmallIntSort {
+public:
+    static const int MAX_SIMD_CLASSES = 8;
+
+    static void sort(vector<int>& nums, int k, int threads = 0) {
+
+        size_t n = nums.size();
+
+        if (k <= 0) {
+            throw invalid_argument("SmallIntSort: k must be positive");
+        }
+
+        if (threads <= 0) {
+            threads = n < (1 << 20) ? 1 : max(1u, thread::hardware_concurrency());
+        }
+
+        vector<vector<size_t>> partial(threads, vector<size_t>(k + 1, 0));
+        size_t chunk = (n + threads - 1) / threads;
+
+        parallelFor(threads, [&](int t) {
+            size_t lo = min(n, t * chunk);
+            size_t hi = min(n, lo + chunk);
+            countClasses(nums.data() + lo, hi - lo, k, partial[t].data());
+        });
+
+        for (int t = 0; t < threads; t++) {
+
+            if (partial[t][k] != 0) {
+                throw out_of_range("SmallIntSort: value outside [0, k)");
+            }
+        }
+
+        vector<size_t> start(k + 1, 0);
+
+        for (int c = 0; c < k; c++) {
+
+            size_t total = 0;
+
+            for (int t = 0; t < threads; t++) {
+                total += partial[t][c];
+            }
+
+            start[c + 1] = start[c] + total;
+        }
+
+        // Each thread fills its own slice of the output, whatever classes
+        // that slice happens to span.
+        parallelFor(threads, [&](int t) {
+
+            size_t lo = min(n, t * chunk);
+            size_t hi = min(n, lo + chunk);
+
+            for (int c = 0; c < k && lo < hi; c++) {
+
+                size_t a = max(lo, start[c]);
+                size_t b = min(hi, start[c + 1]);
+
+                if (a < b) {
+                    fillValue(nums.data() + a, b - a, c);
+                }
+            }
+        });
+    }
+
+private:
+    template <class Task>
+    static void parallelFor(int threads, Task&& task) {
+
+        vector<thread> pool;
+
+        for (int t = 1; t < threads; t++) {
+            pool.emplace_back(task, t);
+        }
+
+        task(0);
+
+        for (thread& th : pool) {
+            th.join();
+        }
+    }
+
+    static bool hasAvx2() {
+#ifdef SMALL_INT_SORT_X86
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    static void countClasses(const int* a, size_t n, int k, size_t* counts) {
+#ifdef SMALL_INT_SORT_X86
+        if (k <= MAX_SIMD_CLASSES && hasAvx2()) {
+            countClassesAvx2(a, n, k, counts);
+            return;
+        }
+#endif
+        countClassesScalar(a, n, k, counts);
+    }
+
+    static void fillValue(int* a, size_t n, int v) {
+#ifdef SMALL_INT_SORT_X86
+        if (hasAvx2()) {
+            fillValueAvx2(a, n, v);
+            return;
+        }
+#endif
+        fill(a, a + n, v);
+    }
+
+    // Out-of-range values (negative ones wrap to large unsigned) land in
+    // counts[k].
+    static void countClassesScalar(const int* a, size_t n, int k, size_t* counts) {
+        for (size_t i = 0; i < n; i++) {
+            counts[min((unsigned)a[i], (unsigned)k)]++;
+        }
+    }
+
+#ifdef SMALL_INT_SORT_X86
+    __attribute__((target("avx2")))
+    static void countClassesAvx2(const int* a, size_t n, int k, size_t* counts) {
+
+        // Each lane subtracts the all-ones compare mask, i.e. adds one per
+        // match. Lanes are flushed before a 32-bit lane could overflow.
+        // Elements that matched no class are out of range and go to
+        // counts[k], like in the scalar path.
+        const size_t BLOCK = size_t(1) << 28;
+
+        size_t i = 0;
+
+        while (i + 8 <= n) {
+
+            __m256i acc[MAX_SIMD_CLASSES];
+            __m256i key[MAX_SIMD_CLASSES];
+
+            for (int c = 0; c < k; c++) {
+                acc[c] = _mm256_setzero_si256();
+                key[c] = _mm256_set1_epi32(c);
+            }
+
+            size_t begin = i;
+            size_t end = i + min(BLOCK, (n - i) / 8 * 8);
+
+            for (; i < end; i += 8) {
+
+                __m256i v = _mm256_loadu_si256((const __m256i*)(a + i));
+
+                for (int c = 0; c < k; c++) {
+                    acc[c] = _mm256_sub_epi32(acc[c], _mm256_cmpeq_epi32(v, key[c]));
+                }
+            }
+
+            size_t matched = 0;
+
+            for (int c = 0; c < k; c++) {
+
+                alignas(32) uint32_t lanes[8];
+                _mm256_store_si256((__m256i*)lanes, acc[c]);
+
+                size_t classCount = 0;
+
+                for (int l = 0; l < 8; l++) {
+                    classCount += lanes[l];
+                }
+
+                counts[c] += classCount;
+                matched += classCount;
+            }
+
+            counts[k] += (end - begin) - matched;
+        }
+
+        countClassesScalar(a + i, n - i, k, counts);
+    }
+
+    __attribute__((target("avx2")))
+    static void fillValueAvx2(int* a, size_t n, int v) {
+
+        __m256i value = _mm256_set1_epi32(v);
+
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8) {
+            _mm256_storeu_si256((__m256i*)(a + i), value);
+        }
+
+        for (; i < n; i++) {
+            a[i] = v;
+        }
+    }
+#endif
+};
+
 class Solution {
 public:
     void sortColors(vector<int>& nums) {
+        SmallIntSort::sort(nums, 3);
+    }
+
+    // Single-pass Dutch national flag partition, no extra memory.
+    void sortColorsDutchFlag(vector<int>& nums) {
 
         int low = 0;
         int mid = 0;
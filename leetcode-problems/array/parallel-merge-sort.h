@@ -0,0 +1,368 @@
+/*
+╔══════════════════════════════════════════════════════════════════════════════╗
+║                             SHARED ARRAY UTILITY                             ║
+╠══════════════════════════════════════════════════════════════════════════════╣
+║ Component     : WorkStealingPool, ParallelMergeSort                          ║
+║ Used By       : concepts/algorithm-design.md                                 ║
+║ Topic         : Sorting, Divide & Conquer, Parallelism                       ║
+╚══════════════════════════════════════════════════════════════════════════════╝
+
+📋 DESCRIPTION:
+WorkStealingPool runs fork/join tasks. Every thread owns a deque: it
+pushes and pops its own tasks at the back (most recent, cache-warm), and
+idle threads steal from the front of the others (oldest, largest). A
+thread waiting on a TaskGroup runs queued tasks instead of blocking, so
+nested groups cannot deadlock the pool.
+
+ParallelMergeSort<T, Compare> is a stable merge sort on top of it:
+- one auxiliary buffer per sort; source and destination swap roles at
+  every level, so nothing is copied back
+- merges larger than the grain are cut along merge-path diagonals into
+  equal independent slices, so the top-level merge scales too
+- insertion sort below 32 elements, serial recursion below the grain
+  (about n / 8p elements)
+
+T must be default-constructible and movable.
+
+⏰ TIME COMPLEXITY: O(n log n) work, about O(n log n / p) on p threads
+💾 SPACE COMPLEXITY: O(n) [one auxiliary buffer]
+*/
+
+#pragma once
+
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(unsigned threads = thread::hardware_concurrency()) {
+
+        threads = max(1u, threads);
+
+        for (unsigned i = 0; i < threads; i++) {
+            queues.push_back(make_unique<Queue>());
+        }
+
+        for (unsigned i = 1; i < threads; i++) {
+            workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+        }
+    }
+
+    ~WorkStealingPool() {
+
+        {
+            lock_guard<mutex> guard(sleepLock);
+            stopping = true;
+        }
+
+        wake.notify_all();
+
+        for (thread& t : workers) {
+            t.join();
+        }
+    }
+
+    // Worker threads plus the calling thread, which runs tasks while it waits.
+    size_t size() const {
+        return queues.size();
+    }
+
+    void submit(function<void()> task) {
+
+        size_t q = home();
+
+        {
+            lock_guard<mutex> guard(queues[q]->lock);
+            queues[q]->tasks.push_back(move(task));
+        }
+
+        queued++;
+
+        // Taking the lock orders this wake-up after a sleeper's predicate check.
+        {
+            lock_guard<mutex> guard(sleepLock);
+        }
+
+        wake.notify_one();
+    }
+
+    // Runs one task: own deque first, then steal round-robin from the others.
+    bool runPending() {
+
+        size_t q = home();
+        function<void()> task;
+
+        bool found = popFrom(q, true, task);
+
+        for (size_t i = 1; !found && i < queues.size(); i++) {
+            found = popFrom((q + i) % queues.size(), false, task);
+        }
+
+        if (found) {
+            task();
+        }
+
+        return found;
+    }
+
+    class TaskGroup {
+    public:
+        explicit TaskGroup(WorkStealingPool& p) : pool(p) {}
+
+        ~TaskGroup() {
+            wait();
+        }
+
+        template <class F>
+        void run(F&& f) {
+
+            pending++;
+
+            pool.submit([this, f = forward<F>(f)]() mutable {
+                f();
+                pending--;
+            });
+        }
+
+        void wait() {
+
+            while (pending > 0) {
+
+                if (!pool.runPending()) {
+                    this_thread::yield();
+                }
+            }
+        }
+
+    private:
+        WorkStealingPool& pool;
+        atomic<size_t> pending{0};
+    };
+
+private:
+    struct Queue {
+        mutex lock;
+        deque<function<void()>> tasks;
+    };
+
+    // Queue 0 is shared by threads outside the pool.
+    vector<unique_ptr<Queue>> queues;
+    vector<thread> workers;
+
+    atomic<size_t> queued{0};
+    mutex sleepLock;
+    condition_variable wake;
+    bool stopping = false;
+
+    static inline thread_local WorkStealingPool* owner = nullptr;
+    static inline thread_local size_t self = 0;
+
+    size_t home() const {
+        return owner == this ? self : 0;
+    }
+
+    bool popFrom(size_t q, bool back, function<void()>& task) {
+
+        lock_guard<mutex> guard(queues[q]->lock);
+
+        deque<function<void()>>& tasks = queues[q]->tasks;
+
+        if (tasks.empty()) {
+            return false;
+        }
+
+        if (back) {
+            task = move(tasks.back());
+            tasks.pop_back();
+        } else {
+            task = move(tasks.front());
+            tasks.pop_front();
+        }
+
+        queued--;
+
+        return true;
+    }
+
+    void workerLoop(size_t id) {
+
+        owner = this;
+        self = id;
+
+        while (true) {
+
+            if (runPending()) {
+                continue;
+            }
+
+            unique_lock<mutex> guard(sleepLock);
+
+            wake.wait(guard, [this]() { return stopping || queued > 0; });
+
+            if (stopping) {
+                return;
+            }
+        }
+    }
+};
+
+template <class T, class Compare = less<T>>
+class ParallelMergeSort {
+public:
+    explicit ParallelMergeSort(WorkStealingPool& p, Compare c = Compare()) : pool(p), comp(c) {}
+
+    void sort(vector<T>& arr) {
+
+        size_t n = arr.size();
+
+        if (n <= 1) {
+            return;
+        }
+
+        // About 8 tasks per thread balances load without drowning in scheduling.
+        grain = max<size_t>(n / (pool.size() * 8), 4096);
+
+        vector<T> buf(n);
+
+        sortRange(arr.data(), buf.data(), n, false);
+    }
+
+private:
+    static const size_t INSERTION_CUTOFF = 32;
+
+    WorkStealingPool& pool;
+    Compare comp;
+
+    // Below this size a range is sorted or merged serially.
+    size_t grain = 0;
+
+    void insertionSort(T* a, size_t n) {
+
+        for (size_t i = 1; i < n; i++) {
+
+            T key = move(a[i]);
+            size_t j = i;
+
+            while (j > 0 && comp(key, a[j - 1])) {
+                a[j] = move(a[j - 1]);
+                j--;
+            }
+
+            a[j] = move(key);
+        }
+    }
+
+    // Stable merge of a[0, n1) and b[0, n2) into out.
+    void mergeSerial(T* a, size_t n1, T* b, size_t n2, T* out) {
+
+        size_t i = 0;
+        size_t j = 0;
+
+        while (i < n1 && j < n2) {
+
+            if (comp(b[j], a[i])) {
+                *out++ = move(b[j++]);
+            } else {
+                *out++ = move(a[i++]);
+            }
+        }
+
+        out = move(a + i, a + n1, out);
+        move(b + j, b + n2, out);
+    }
+
+    // Merge path: how many of the first d merged outputs come from a.
+    size_t splitDiagonal(T* a, size_t n1, T* b, size_t n2, size_t d) {
+
+        size_t lo = d > n2 ? d - n2 : 0;
+        size_t hi = min(d, n1);
+
+        while (lo < hi) {
+
+            size_t i = lo + (hi - lo) / 2;
+
+            // a[i] is output before b[d - i - 1], so more of a belongs in front.
+            if (!comp(b[d - i - 1], a[i])) {
+                lo = i + 1;
+            } else {
+                hi = i;
+            }
+        }
+
+        return lo;
+    }
+
+    // Cuts the output into equal slices along merge-path diagonals; every
+    // slice is an independent serial merge.
+    void merge(T* a, size_t n1, T* b, size_t n2, T* out) {
+
+        size_t total = n1 + n2;
+        size_t parts = min(pool.size() * 4, total / grain);
+
+        if (parts <= 1) {
+            mergeSerial(a, n1, b, n2, out);
+            return;
+        }
+
+        // All cuts are found before any slice starts moving elements out of a and b.
+        vector<size_t> cut(parts + 1, n1);
+        cut[0] = 0;
+
+        for (size_t k = 1; k < parts; k++) {
+            cut[k] = splitDiagonal(a, n1, b, n2, total * k / parts);
+        }
+
+        WorkStealingPool::TaskGroup group(pool);
+
+        for (size_t k = 0; k < parts; k++) {
+
+            size_t d0 = total * k / parts;
+            size_t d1 = total * (k + 1) / parts;
+            size_t i0 = cut[k];
+            size_t i1 = cut[k + 1];
+
+            group.run([=, this]() {
+                mergeSerial(a + i0, i1 - i0, b + (d0 - i0), (d1 - i1) - (d0 - i0), out + d0);
+            });
+        }
+
+        group.wait();
+    }
+
+    // Sorts the n elements in data. The result ends up in data, or in buf
+    // when intoBuf is set. Children sort into the opposite buffer, so each
+    // level merges from one array into the other with no copying back.
+    void sortRange(T* data, T* buf, size_t n, bool intoBuf) {
+
+        if (n <= INSERTION_CUTOFF) {
+
+            insertionSort(data, n);
+
+            if (intoBuf) {
+                move(data, data + n, buf);
+            }
+
+            return;
+        }
+
+        size_t half = n / 2;
+
+        if (n > grain) {
+
+            WorkStealingPool::TaskGroup group(pool);
+
+            group.run([=, this]() {
+                sortRange(data, buf, half, !intoBuf);
+            });
+
+            sortRange(data + half, buf + half, n - half, !intoBuf);
+
+            group.wait();
+        } else {
+            sortRange(data, buf, half, !intoBuf);
+            sortRange(data + half, buf + half, n - half, !intoBuf);
+        }
+
+        T* src = intoBuf ? data : buf;
+        T* dst = intoBuf ? buf : data;
+
+        merge(src, half, src + half, n - half, dst);
+    }
+};
@@ -0,0 +1,285 @@
+/*
+╔══════════════════════════════════════════════════════════════════════════════╗
+║                             SHARED ARRAY UTILITY                             ║
+╠══════════════════════════════════════════════════════════════════════════════╣
+║ Component     : TrapezoidCounter                                             ║
+║ Used By       : leetcode-3623.cpp, leetcode-3625.cpp                         ║
+║ Topic         : Geometry, Radix Sort, Combinatorics                          ║
+╚══════════════════════════════════════════════════════════════════════════════╝
+
+📋 DESCRIPTION:
+Counts trapezoids (quadrilaterals with at least one pair of parallel sides)
+among distinct points, without hashing.
+
+Every point pair becomes two 64-bit keys:
+- line key     : normalized direction (dx, dy) | intercept c = dy*x - dx*y
+- midpoint key : (x1 + x2, y1 + y2) | normalized direction
+
+Both arrays are grouped with a parallel LSD radix sort and scanned once:
+- two segments with the same direction on different lines give one pair
+  of parallel sides: per direction, (S² - Σ lineCount²) / 2
+- a parallelogram has two such pairs and is counted twice; its diagonals
+  are the only two segments sharing a midpoint with different directions,
+  so per midpoint (M² - Σ directionCount²) / 2 is subtracted once.
+
+Coordinates must satisfy |x|, |y| <= 8191 so every field fits its slot;
+countAll throws out_of_range for any point outside that box.
+
+⏰ TIME COMPLEXITY: O(n²) [radix sort is linear in the n² keys]
+💾 SPACE COMPLEXITY: O(n²)
+*/
+
+#pragma once
+
+class TrapezoidCounter {
+public:
+    static const int COORD_LIMIT = 8191;
+
+    static long long countAll(const vector<vector<int>>& points, int threads = 0) {
+
+        size_t n = points.size();
+        size_t m = n * (n - 1) / 2;
+
+        if (n < 4) {
+            return 0;
+        }
+
+        for (const vector<int>& p : points) {
+
+            if (p[0] < -COORD_LIMIT || p[0] > COORD_LIMIT || p[1] < -COORD_LIMIT || p[1] > COORD_LIMIT) {
+                throw out_of_range("TrapezoidCounter: coordinates must be within +-8191");
+            }
+        }
+
+        threads = resolveThreads(threads, m);
+
+        vector<uint64_t> lines(m);
+        vector<uint64_t> mids(m);
+
+        // Rows are dealt round-robin because row i holds n - 1 - i pairs.
+        runThreads(threads, [&](int t) {
+
+            for (size_t i = t; i < n; i += threads) {
+
+                size_t at = i * n - i * (i + 1) / 2;
+
+                for (size_t j = i + 1; j < n; j++, at++) {
+                    makeKeys(points[i], points[j], lines[at], mids[at]);
+                }
+            }
+        });
+
+        radixSort(lines, threads);
+        radixSort(mids, threads);
+
+        long long parallelPairs = 0;
+
+        forEachGroup(lines, SLOPE_SHIFT, [&](size_t lo, size_t hi) {
+            parallelPairs += pairsAcrossSubgroups(lines, lo, hi);
+        });
+
+        long long parallelograms = 0;
+
+        forEachGroup(mids, MID_SHIFT, [&](size_t lo, size_t hi) {
+            parallelograms += pairsAcrossSubgroups(mids, lo, hi);
+        });
+
+        return parallelPairs - parallelograms;
+    }
+
+    // Trapezoids with a pair of horizontal sides, modulo 1e9+7: any two
+    // segments on different horizontal lines.
+    static int countHorizontal(const vector<vector<int>>& points, int threads = 0) {
+
+        const long long MOD = 1000000007LL;
+
+        vector<uint64_t> ys(points.size());
+
+        for (size_t i = 0; i < points.size(); i++) {
+            ys[i] = (uint64_t)((long long)points[i][1] - INT_MIN);
+        }
+
+        radixSort(ys, resolveThreads(threads, ys.size()));
+
+        long long sum = 0;
+        long long ans = 0;
+
+        forEachGroup(ys, 0, [&](size_t lo, size_t hi) {
+
+            long long cnt = hi - lo;
+            long long ways = cnt * (cnt - 1) / 2 % MOD;
+
+            ans = (ans + ways * sum) % MOD;
+            sum = (sum + ways) % MOD;
+        });
+
+        return (int)ans;
+    }
+
+private:
+    // Line key    : [ slope : 29 ][ c + C_BIAS : 30 ]
+    // Midpoint key: [ mx : 15 ][ my : 15 ][ slope : 29 ]
+    static const int SLOPE_BITS = 29;
+    static const int SLOPE_SHIFT = 30;
+    static const int MID_SHIFT = SLOPE_BITS;
+
+    static const int64_t DY_BIAS = 1 << 14;
+    static const int64_t C_BIAS = int64_t(1) << 29;
+    static const int64_t MID_BIAS = 1 << 14;
+
+    static void makeKeys(const vector<int>& p, const vector<int>& q, uint64_t& line, uint64_t& mid) {
+
+        int64_t dx = q[0] - p[0];
+        int64_t dy = q[1] - p[1];
+
+        int64_t g = gcd(llabs(dx), llabs(dy));
+
+        dx /= g;
+        dy /= g;
+
+        if (dx < 0 || (dx == 0 && dy < 0)) {
+            dx = -dx;
+            dy = -dy;
+        }
+
+        uint64_t slope = (uint64_t)dx << 15 | (uint64_t)(dy + DY_BIAS);
+
+        int64_t c = dy * p[0] - dx * p[1];
+
+        line = slope << SLOPE_SHIFT | (uint64_t)(c + C_BIAS);
+
+        uint64_t mx = (uint64_t)(p[0] + q[0] + MID_BIAS);
+        uint64_t my = (uint64_t)(p[1] + q[1] + MID_BIAS);
+
+        mid = (mx << 15 | my) << MID_SHIFT | slope;
+    }
+
+    // Keys in [lo, hi) belong to one group and are sorted; equal keys form
+    // a subgroup. Returns the number of pairs taken from two different
+    // subgroups.
+    static long long pairsAcrossSubgroups(const vector<uint64_t>& keys, size_t lo, size_t hi) {
+
+        long long total = hi - lo;
+        long long same = 0;
+
+        for (size_t i = lo; i < hi; ) {
+
+            size_t j = i;
+
+            while (j < hi && keys[j] == keys[i]) {
+                j++;
+            }
+
+            same += (long long)(j - i) * (j - i);
+            i = j;
+        }
+
+        return (total * total - same) / 2;
+    }
+
+    template <class Visit>
+    static void forEachGroup(const vector<uint64_t>& keys, int shift, Visit&& visit) {
+
+        for (size_t i = 0; i < keys.size(); ) {
+
+            uint64_t group = keys[i] >> shift;
+
+            size_t j = i + 1;
+
+            while (j < keys.size() && (keys[j] >> shift) == group) {
+                j++;
+            }
+
+            visit(i, j);
+            i = j;
+        }
+    }
+
+    // LSD radix sort, 16 bits per pass. Each thread histograms its slice,
+    // the histograms are turned into per-thread bucket offsets, and each
+    // thread scatters its slice; passes over all-zero digits are skipped.
+    static void radixSort(vector<uint64_t>& keys, int threads) {
+
+        const int BITS = 16;
+        const size_t BUCKETS = size_t(1) << BITS;
+
+        size_t n = keys.size();
+
+        uint64_t all = 0;
+
+        for (uint64_t k : keys) {
+            all |= k;
+        }
+
+        vector<uint64_t> buffer(n);
+        vector<vector<size_t>> count(threads, vector<size_t>(BUCKETS));
+
+        size_t chunk = (n + threads - 1) / threads;
+
+        for (int shift = 0; shift < 64; shift += BITS) {
+
+            if (((all >> shift) & (BUCKETS - 1)) == 0) {
+                continue;
+            }
+
+            runThreads(threads, [&](int t) {
+
+                fill(count[t].begin(), count[t].end(), 0);
+
+                size_t lo = min(n, t * chunk);
+                size_t hi = min(n, lo + chunk);
+
+                for (size_t i = lo; i < hi; i++) {
+                    count[t][(keys[i] >> shift) & (BUCKETS - 1)]++;
+                }
+            });
+
+            size_t offset = 0;
+
+            for (size_t b = 0; b < BUCKETS; b++) {
+                for (int t = 0; t < threads; t++) {
+                    size_t c = count[t][b];
+                    count[t][b] = offset;
+                    offset += c;
+                }
+            }
+
+            runThreads(threads, [&](int t) {
+
+                size_t lo = min(n, t * chunk);
+                size_t hi = min(n, lo + chunk);
+
+                for (size_t i = lo; i < hi; i++) {
+                    buffer[count[t][(keys[i] >> shift) & (BUCKETS - 1)]++] = keys[i];
+                }
+            });
+
+            keys.swap(buffer);
+        }
+    }
+
+    static int resolveThreads(int threads, size_t work) {
+
+        if (threads > 0) {
+            return threads;
+        }
+
+        return work < (1 << 20) ? 1 : max(1u, thread::hardware_concurrency());
+    }
+
+    template <class Task>
+    static void runThreads(int threads, Task&& task) {
+
+        vector<thread> pool;
+
+        for (int t = 1; t < threads; t++) {
+            pool.emplace_back(task, t);
+        }
+
+        task(0);
+
+        for (thread& th : pool) {
+            th.join();
+        }
+    }
+};
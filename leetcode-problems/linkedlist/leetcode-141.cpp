@@ -32,7 +32,7 @@ Output: false
 - -10^5 <= Node.val <= 10^5
 - pos is -1 or a valid index in the linked-list
 
-⏰ TIME COMPLEXITY: O(N)
+⏰ TIME COMPLEXITY: O(N) per list
 💾 SPACE COMPLEXITY: O(1)
 */
 
@@ -45,25 +45,191 @@ Output: false
  * };
  */
 
+struct CycleInfo {
+    ListNode* start = NULL;
+    int length = 0;
+};
+
 class Solution {
 public:
     bool hasCycle(ListNode *head) {
+        return findCycle(head).length != 0;
+    }
+
+    // Brent's algorithm: the tortoise teleports to the hare at every power
+    // of two, so detection follows only one pointer per step and yields the
+    // cycle length directly. The entry is then found by running two
+    // pointers length apart.
+    CycleInfo findCycle(ListNode *head) {
+
+        CycleInfo info;
 
         if(head == NULL)
-            return false;
+            return info;
+
+        ListNode* tortoise = head;
+        ListNode* hare = head->next;
+
+        int power = 1;
+        int lam = 1;
+
+        while(hare != tortoise){
+
+            if(hare == NULL)
+                return info;
+
+            if(power == lam){
+                tortoise = hare;
+                power *= 2;
+                lam = 0;
+            }
+
+            hare = hare->next;
+            lam++;
+        }
+
+        tortoise = head;
+        hare = head;
+
+        for(int i = 0; i < lam; i++)
+            hare = hare->next;
+
+        while(tortoise != hare){
+            tortoise = tortoise->next;
+            hare = hare->next;
+        }
+
+        info.start = tortoise;
+        info.length = lam;
+
+        return info;
+    }
+
+    // Runs the same Brent walk on many lists at once. A fixed window of
+    // walks is in flight; each round advances every one of them by one
+    // step and prefetches the node it will read next, so cache misses of
+    // different lists overlap instead of being paid one after another. A
+    // finished walk is replaced by the next list from the input, so the
+    // total work is the sum of the walk lengths.
+    vector<CycleInfo> findCycles(const vector<ListNode*>& heads) {
+
+        enum Stage { DETECT, ADVANCE, MEET };
+
+        struct Walk {
+            int id;
+            ListNode* tortoise;
+            ListNode* hare;
+            int power;
+            int lam;
+            int steps;
+            Stage stage;
+        };
+
+        const int WINDOW = 16;
+
+        int n = heads.size();
+
+        vector<CycleInfo> result(n);
+        Walk walks[WINDOW];
+
+        int next = 0;
+        int inFlight = 0;
+
+        // Loads the next non-empty list into w; false once the input is used up.
+        auto refill = [&](Walk& w) {
+
+            while(next < n && heads[next] == NULL)
+                next++;
+
+            if(next == n)
+                return false;
+
+            ListNode* h = heads[next];
+
+            w = {next++, h, h->next, 1, 1, 0, DETECT};
+
+            __builtin_prefetch(w.hare);
+            return true;
+        };
+
+        while(inFlight < WINDOW && refill(walks[inFlight]))
+            inFlight++;
+
+        while(inFlight > 0){
+
+            for(int s = 0; s < inFlight; ){
+
+                Walk& w = walks[s];
+                bool done = false;
+
+                switch(w.stage){
+
+                case DETECT:
+
+                    if(w.hare == w.tortoise){
+                        w.tortoise = heads[w.id];
+                        w.hare = heads[w.id];
+                        w.steps = w.lam;
+                        w.stage = ADVANCE;
+                        break;
+                    }
+
+                    if(w.hare == NULL){
+                        done = true;
+                        break;
+                    }
+
+                    if(w.power == w.lam){
+                        w.tortoise = w.hare;
+                        w.power *= 2;
+                        w.lam = 0;
+                    }
+
+                    w.hare = w.hare->next;
+                    w.lam++;
+
+                    __builtin_prefetch(w.hare);
+                    break;
+
+                case ADVANCE:
+
+                    if(w.steps == 0){
+                        w.stage = MEET;
+                        break;
+                    }
+
+                    w.hare = w.hare->next;
+                    w.steps--;
+
+                    __builtin_prefetch(w.hare);
+                    break;
+
+                case MEET:
 
-        ListNode* slow = head;
-        ListNode* fast = head;
+                    if(w.tortoise == w.hare){
+                        result[w.id] = {w.tortoise, w.lam};
+                        done = true;
+                        break;
+                    }
 
-        while(fast != NULL && fast->next != NULL){
+                    w.tortoise = w.tortoise->next;
+                    w.hare = w.hare->next;
 
-            slow = slow->next;
-            fast = fast->next->next;
+                    __builtin_prefetch(w.tortoise);
+                    __builtin_prefetch(w.hare);
+                    break;
+                }
 
-            if(slow == fast)
-                return true;
+                if(done && !refill(w)){
+                    // Input exhausted: swap-remove; the moved walk has not
+                    // been stepped this round, so stay on this slot.
+                    w = walks[--inFlight];
+                } else {
+                    s++;
+                }
+            }
         }
 
-        return false;
+        return result;
     }
 };
\ No newline at end of file
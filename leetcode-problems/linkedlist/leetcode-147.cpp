@@ -28,8 +28,8 @@ Output: [-1,0,3,4,5]
 - The number of nodes in the list is in the range [1, 5000]
 - -5000 <= Node.val <= 5000
 
-⏰ TIME COMPLEXITY: O(N²)
-💾 SPACE COMPLEXITY: O(N)
+⏰ TIME COMPLEXITY: O(N²) worst, close to O(N) when elements are displaced only locally
+💾 SPACE COMPLEXITY: O(1)
 */
 
 /**
@@ -45,49 +45,168 @@ Output: [-1,0,3,4,5]
 
 class Solution {
 public:
+    ListNode* insertionSortList(ListNode* head) {
+
+        ListNode dummy(INT_MIN);
+
+        ListNode* tail = &dummy;
+        ListNode* hint = &dummy;
+
+        // The most recently appended nodes. Nearly-sorted input displaces
+        // elements only a short distance, so one of these is usually just
+        // in front of the insertion point.
+        const int FINGERS = 16;
+        ListNode* recent[FINGERS];
+        int appended = 0;
+
+        fill(recent, recent + FINGERS, &dummy);
+
+        while(head != NULL){
+
+            ListNode* node = head;
+            head = head->next;
 
-    void insertion(vector<int>& arr){
+            // Already-sorted runs extend the tail in O(1).
+            if(node->val >= tail->val){
 
-        int n = arr.size();
+                tail->next = node;
+                node->next = NULL;
+                tail = node;
 
-        for(int i = 1; i < n; i++){
+                recent[appended++ % FINGERS] = node;
+                continue;
+            }
 
-            int key = arr[i];
-            int j = i - 1;
+            // Any node whose value is <= the target is a valid place to start
+            // walking; take the closest one among the last insertion point
+            // and the recent tail nodes.
+            ListNode* prev = (hint->val <= node->val) ? hint : &dummy;
 
-            while(j >= 0 && arr[j] > key){
+            for(ListNode* f : recent){
+                if(f->val <= node->val && f->val > prev->val){
+                    prev = f;
+                }
+            }
 
-                arr[j + 1] = arr[j];
-                j--;
+            while(prev->next->val <= node->val){
+                prev = prev->next;
             }
 
-            arr[j + 1] = key;
+            node->next = prev->next;
+            prev->next = node;
+
+            hint = node;
         }
+
+        return dummy.next;
     }
+};
 
-    ListNode* insertionSortList(ListNode* head) {
+// The original approach, kept as the benchmark baseline: copy the values
+// out, insertion-sort the vector, and build a fresh list.
+ListNode* insertionSortListByValues(ListNode* head) {
 
-        vector<int> arr;
+    vector<int> arr;
 
-        while(head != NULL){
+    while(head != NULL){
+        arr.push_back(head->val);
+        head = head->next;
+    }
 
-            arr.push_back(head->val);
-            head = head->next;
+    for(int i = 1; i < (int)arr.size(); i++){
+
+        int key = arr[i];
+        int j = i - 1;
+
+        while(j >= 0 && arr[j] > key){
+            arr[j + 1] = arr[j];
+            j--;
         }
 
-        insertion(arr);
+        arr[j + 1] = key;
+    }
+
+    ListNode dummy(-1);
+    ListNode* temp = &dummy;
+
+    for(int v : arr){
+        temp->next = new ListNode(v);
+        temp = temp->next;
+    }
 
-        ListNode* newHead = new ListNode(-1);
-        ListNode* temp = newHead;
+    return dummy.next;
+}
 
-        for(int i = 0; i < arr.size(); i++){
+// Presortedness sweep: a sorted sequence with the given fraction of
+// positions swapped with a neighbour at most 8 places away, plus a fully
+// shuffled input. Both versions must produce the same sequence.
+void benchmarkInsertionSortList(int n = 20000) {
+
+    mt19937 rng(42);
+
+    vector<int> sorted(n);
+
+    for(int i = 0; i < n; i++){
+        sorted[i] = i / 2;
+    }
+
+    const double levels[] = {0.0, 0.001, 0.01, 0.1, -1.0};
+
+    for(double level : levels){
+
+        vector<int> vals = sorted;
+
+        if(level < 0){
+            shuffle(vals.begin(), vals.end(), rng);
+        } else {
+            for(int i = 0; i < n; i++){
+                if(rng() % 1000000 < level * 1000000){
+                    swap(vals[i], vals[min(n - 1, i + 1 + (int)(rng() % 8))]);
+                }
+            }
+        }
+
+        vector<ListNode> nodes(n);
+
+        for(int i = 0; i < n; i++){
+            nodes[i].val = vals[i];
+            nodes[i].next = i + 1 < n ? &nodes[i + 1] : NULL;
+        }
+
+        auto t0 = chrono::steady_clock::now();
+        ListNode* byValues = insertionSortListByValues(&nodes[0]);
+        auto t1 = chrono::steady_clock::now();
+        ListNode* relinked = Solution().insertionSortList(&nodes[0]);
+        auto t2 = chrono::steady_clock::now();
+
+        bool same = true;
+
+        for(ListNode *a = byValues, *b = relinked; a != NULL || b != NULL; ){
+
+            if(a == NULL || b == NULL || a->val != b->val){
+                same = false;
+                break;
+            }
+
+            a = a->next;
+            b = b->next;
+        }
+
+        while(byValues != NULL){
+            ListNode* next = byValues->next;
+            delete byValues;
+            byValues = next;
+        }
 
-            ListNode* node = new ListNode(arr[i]);
+        double vectorMs = chrono::duration<double, milli>(t1 - t0).count();
+        double relinkMs = chrono::duration<double, milli>(t2 - t1).count();
 
-            temp->next = node;
-            temp = node;
+        if(level < 0){
+            printf("shuffled      ");
+        } else {
+            printf("swaps=%5.1f%%  ", level * 100);
         }
 
-        return newHead->next;
+        printf("vector=%9.3fms  relink=%9.3fms  %s\n", vectorMs, relinkMs, same ? "ok" : "MISMATCH");
     }
-};
\ No newline at end of file
+}
\ No newline at end of file
@@ -31,7 +31,7 @@ Output: []
 - -10^5 <= Node.val <= 10^5
 
 ⏰ TIME COMPLEXITY: O(N log N)
-💾 SPACE COMPLEXITY: O(log N) [Recursion Stack]
+💾 SPACE COMPLEXITY: O(1) [bottom-up, no recursion]
 */
 
 /**
@@ -50,8 +50,8 @@ public:
 
     ListNode* merge(ListNode* left, ListNode* right) {
 
-        ListNode* dummy = new ListNode(-1);
-        ListNode* temp = dummy;
+        ListNode dummy(-1);
+        ListNode* temp = &dummy;
 
         while(left != NULL && right != NULL) {
 
@@ -69,45 +69,134 @@ public:
             temp = temp->next;
         }
 
-        if(left != NULL) {
-            temp->next = left;
-        }
-
-        if(right != NULL) {
-            temp->next = right;
-        }
+        temp->next = (left != NULL) ? left : right;
 
-        return dummy->next;
+        return dummy.next;
     }
 
-    ListNode* findMid(ListNode* head) {
+    // Detaches the maximal non-decreasing run at the front of *head.
+    ListNode* takeRun(ListNode*& head) {
 
-        ListNode* slow = head;
-        ListNode* fast = head->next;
+        ListNode* run = head;
+        ListNode* tail = head;
 
-        while(fast != NULL && fast->next != NULL) {
-
-            slow = slow->next;
-            fast = fast->next->next;
+        while(tail->next != NULL && tail->val <= tail->next->val) {
+            tail = tail->next;
         }
 
-        return slow;
+        head = tail->next;
+        tail->next = NULL;
+
+        return run;
     }
 
+    // Natural bottom-up merge sort. bins[i] holds a sorted list built from
+    // 2^i runs, so merges stay balanced and an already sorted input is a
+    // single run that is returned after one pass.
     ListNode* sortList(ListNode* head) {
 
         if(head == NULL || head->next == NULL) {
             return head;
         }
 
-        ListNode* mid = findMid(head);
+        ListNode* bins[64] = {};
+        int used = 0;
+
+        while(head != NULL) {
+
+            ListNode* carry = takeRun(head);
+
+            int i = 0;
+
+            while(i < used && bins[i] != NULL) {
+
+                carry = merge(bins[i], carry);
+                bins[i] = NULL;
+                i++;
+            }
+
+            bins[i] = carry;
+            used = max(used, i + 1);
+        }
+
+        ListNode* result = NULL;
+
+        for(int i = 0; i < used; i++) {
+            result = merge(bins[i], result);
+        }
+
+        return result;
+    }
+
+    // Cuts the list into one segment per thread, sorts the segments
+    // concurrently, then merges neighbouring results pairwise in parallel.
+    ListNode* sortListParallel(ListNode* head, int threads = 0) {
+
+        if(threads <= 0) {
+            threads = max(1u, thread::hardware_concurrency());
+        }
+
+        int n = 0;
 
-        ListNode* rightHead = mid->next;
-        mid->next = NULL;
+        for(ListNode* p = head; p != NULL; p = p->next) {
+            n++;
+        }
 
-        ListNode* left = sortList(head);
-        ListNode* right = sortList(rightHead);
+        if(threads == 1 || n < (1 << 14)) {
+            return sortList(head);
+        }
+
+        vector<ListNode*> parts;
+        int chunk = (n + threads - 1) / threads;
+
+        while(head != NULL) {
+
+            parts.push_back(head);
+
+            ListNode* tail = head;
+
+            for(int i = 1; i < chunk && tail->next != NULL; i++) {
+                tail = tail->next;
+            }
+
+            head = tail->next;
+            tail->next = NULL;
+        }
+
+        auto runAll = [](int count, auto&& task) {
+
+            vector<thread> pool;
+
+            for(int i = 1; i < count; i++) {
+                pool.emplace_back(task, i);
+            }
+
+            task(0);
+
+            for(thread& t : pool) {
+                t.join();
+            }
+        };
+
+        runAll(parts.size(), [&](int i) {
+            parts[i] = sortList(parts[i]);
+        });
+
+        while(parts.size() > 1) {
+
+            int pairs = parts.size() / 2;
+
+            runAll(pairs, [&](int i) {
+                parts[2 * i] = merge(parts[2 * i], parts[2 * i + 1]);
+            });
+
+            for(int i = 0; i < (int)parts.size(); i += 2) {
+                parts[i / 2] = parts[i];
+            }
+
+            parts.resize((parts.size() + 1) / 2);
+        }
 
-        return merge(left, right);
+        return parts[0];
     }
 };
\ No newline at end of file
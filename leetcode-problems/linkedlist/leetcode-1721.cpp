@@ -29,7 +29,7 @@ Output: [7,9,6,6,8,7,3,0,9,5]
 - 0 <= Node.val <= 100
 
 ⏰ TIME COMPLEXITY: O(n)
-💾 SPACE COMPLEXITY: O(n)
+💾 SPACE COMPLEXITY: O(1)
 */
 
 /**
@@ -47,28 +47,22 @@ class Solution {
 public:
     ListNode* swapNodes(ListNode* head, int k) {
 
-        vector<int> arr;
+        ListNode* first = head;
 
-        ListNode* temp = head;
-
-        while (temp != nullptr) {
-            arr.push_back(temp->val);
-            temp = temp->next;
+        for (int i = 1; i < k; i++) {
+            first = first->next;
         }
 
-        swap(arr[k - 1], arr[arr.size() - k]);
-
-        ListNode* newHead = new ListNode(-1);
-        temp = newHead;
-
-        for (int i = 0; i < arr.size(); i++) {
+        ListNode* second = head;
+        ListNode* fast = first->next;
 
-            ListNode* node = new ListNode(arr[i]);
-
-            temp->next = node;
-            temp = node;
+        while (fast != nullptr) {
+            second = second->next;
+            fast = fast->next;
         }
 
-        return newHead->next;
+        swap(first->val, second->val);
+
+        return head;
     }
 };
\ No newline at end of file
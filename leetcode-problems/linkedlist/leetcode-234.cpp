@@ -24,7 +24,7 @@ Output: false
 - 0 <= Node.val <= 9
 
 ⏰ TIME COMPLEXITY: O(N)
-💾 SPACE COMPLEXITY: O(N)
+💾 SPACE COMPLEXITY: O(1) [list is restored before returning]
 */
 
 /**
@@ -43,30 +43,136 @@ public:
 
     bool isPalindrome(ListNode* head) {
 
-        vector<int> arr;
+        if(head == NULL || head->next == NULL) {
+            return true;
+        }
+
+        ListNode* firstEnd = endOfFirstHalf(head);
+        ListNode* second = reverse(firstEnd->next);
+
+        bool result = true;
+
+        for(ListNode* p = head, *q = second; q != NULL; p = p->next, q = q->next) {
+
+            if(p->val != q->val) {
+                result = false;
+                break;
+            }
+        }
+
+        firstEnd->next = reverse(second);
+
+        return result;
+    }
+
+    // Hashes the two halves concurrently, the second one read backwards,
+    // so a mismatch is rejected without touching any links. Equal hashes
+    // are confirmed with the exact in-place comparison.
+    bool isPalindromeHashed(ListNode* head) {
 
-        ListNode* temp = head;
+        if(head == NULL || head->next == NULL) {
+            return true;
+        }
 
-        while(temp != NULL) {
+        ListNode* slow = head;
+        ListNode* fast = head;
 
-            arr.push_back(temp->val);
+        int half = 0;
 
-            temp = temp->next;
+        while(fast != NULL && fast->next != NULL) {
+            slow = slow->next;
+            fast = fast->next->next;
+            half++;
         }
 
-        int left = 0;
-        int right = arr.size() - 1;
+        ListNode* secondStart = (fast != NULL) ? slow->next : slow;
+
+        uint64_t forward = 0;
+        uint64_t backward = 0;
+
+        auto hashForward = [&]() {
+
+            uint64_t power = 1;
+
+            for(ListNode* p = head; p != slow; p = p->next) {
+                forward = addMod(forward, mulMod(power, key(p->val)));
+                power = mulMod(power, BASE);
+            }
+        };
 
-        while(left < right) {
+        auto hashBackward = [&]() {
 
-            if(arr[left] != arr[right]) {
-                return false;
+            for(ListNode* p = secondStart; p != NULL; p = p->next) {
+                backward = addMod(mulMod(backward, BASE), key(p->val));
             }
+        };
+
+        if(half >= PARALLEL_MIN_HALF) {
+
+            thread worker(hashBackward);
+            hashForward();
+            worker.join();
+        }
+        else {
+
+            hashForward();
+            hashBackward();
+        }
+
+        if(forward != backward) {
+            return false;
+        }
+
+        return isPalindrome(head);
+    }
+
+private:
+    static constexpr uint64_t MOD = (1ULL << 61) - 1;
+    static constexpr uint64_t BASE = 1000003;
+    static constexpr int PARALLEL_MIN_HALF = 1 << 16;
+
+    static uint64_t key(int v) {
+        return (uint64_t)(uint32_t)v + 1;
+    }
+
+    static uint64_t addMod(uint64_t a, uint64_t b) {
+        uint64_t s = a + b;
+        return s >= MOD ? s - MOD : s;
+    }
+
+    static uint64_t mulMod(uint64_t a, uint64_t b) {
+        unsigned __int128 p = (unsigned __int128)a * b;
+        uint64_t r = (uint64_t)(p & MOD) + (uint64_t)(p >> 61);
+        return r >= MOD ? r - MOD : r;
+    }
+
+    ListNode* endOfFirstHalf(ListNode* head) {
+
+        ListNode* slow = head;
+        ListNode* fast = head;
+
+        while(fast->next != NULL && fast->next->next != NULL) {
+            slow = slow->next;
+            fast = fast->next->next;
+        }
+
+        return slow;
+    }
+
+    ListNode* reverse(ListNode* head) {
+
+        ListNode* prev = NULL;
+
+        while(head != NULL) {
+
+            ListNode* nextNode = head->next;
+
+            head->next = prev;
 
-            left++;
-            right--;
+            prev = head;
+            head = nextNode;
         }
 
-        return true;
+        return prev;
     }
 };
\ No newline at end of file
@@ -42,9 +42,146 @@ Array becomes non-decreasing after 2 operations.
 - -10^9 <= nums[i] <= 10^9
 
 ⏰ TIME COMPLEXITY: O(n log n)
-💾 SPACE COMPLEXITY: O(n)
+💾 SPACE COMPLEXITY: O(n) [exactly one heap entry per adjacent pair]
 */
 
+// d-ary min-heap over keys 0..n-1 with a position index, so a key's
+// priority can be changed or the key removed in O(log_d n).
+template <class Priority, int D = 4>
+class IndexedHeap {
+public:
+    explicit IndexedHeap(int n) : pos(n, -1), prio(n) {
+        heap.reserve(n);
+    }
+
+    bool empty() const {
+        return heap.empty();
+    }
+
+    bool contains(int key) const {
+        return pos[key] != -1;
+    }
+
+    int top() const {
+        return heap[0];
+    }
+
+    const Priority& priority(int key) const {
+        return prio[key];
+    }
+
+    void push(int key, const Priority& p) {
+        prio[key] = p;
+        pos[key] = heap.size();
+        heap.push_back(key);
+        siftUp(pos[key]);
+    }
+
+    void update(int key, const Priority& p) {
+
+        if (!contains(key)) {
+            push(key, p);
+            return;
+        }
+
+        bool decreased = p < prio[key];
+
+        prio[key] = p;
+
+        if (decreased) {
+            siftUp(pos[key]);
+        }
+        else {
+            siftDown(pos[key]);
+        }
+    }
+
+    void erase(int key) {
+
+        int i = pos[key];
+
+        if (i == -1) {
+            return;
+        }
+
+        int lastKey = heap.back();
+        heap.pop_back();
+        pos[key] = -1;
+
+        if (i == (int)heap.size()) {
+            return;
+        }
+
+        heap[i] = lastKey;
+        pos[lastKey] = i;
+
+        siftUp(i);
+        siftDown(pos[lastKey]);
+    }
+
+    void pop() {
+        erase(heap[0]);
+    }
+
+private:
+    vector<int> heap;
+    vector<int> pos;
+    vector<Priority> prio;
+
+    void place(int i, int key) {
+        heap[i] = key;
+        pos[key] = i;
+    }
+
+    void siftUp(int i) {
+
+        int key = heap[i];
+
+        while (i > 0) {
+
+            int parent = (i - 1) / D;
+
+            if (!(prio[key] < prio[heap[parent]]))
+                break;
+
+            place(i, heap[parent]);
+            i = parent;
+        }
+
+        place(i, key);
+    }
+
+    void siftDown(int i) {
+
+        int key = heap[i];
+        int n = heap.size();
+
+        while (true) {
+
+            int first = i * D + 1;
+
+            if (first >= n)
+                break;
+
+            int best = first;
+            int last = min(first + D, n);
+
+            for (int c = first + 1; c < last; c++) {
+                if (prio[heap[c]] < prio[heap[best]])
+                    best = c;
+            }
+
+            if (!(prio[heap[best]] < prio[key]))
+                break;
+
+            place(i, heap[best]);
+            i = best;
+        }
+
+        place(i, key);
+    }
+};
+
 class Solution {
 public:
     int minimumPairRemoval(vector<int>& nums) {
@@ -53,32 +190,33 @@ public:
         if (n <= 1)
             return 0;
 
-        vector<long long> a(nums.begin(), nums.end());
+        // Value and both links of an element share one 16-byte slot, so a
+        // merge reads and writes a single cache line per neighbour.
+        struct Slot {
+            long long a;
+            int prev;
+            int next;
+        };
 
-        vector<int> prev(n), next(n);
-        vector<bool> alive(n, true);
+        vector<Slot> node(n);
 
         for (int i = 0; i < n; i++) {
-            prev[i] = i - 1;
-            next[i] = i + 1;
+            node[i] = {nums[i], i - 1, i + 1};
         }
 
-        next[n - 1] = -1;
+        node[n - 1].next = -1;
 
-        priority_queue<
-            pair<long long, int>,
-            vector<pair<long long, int>>,
-            greater<pair<long long, int>>
-        > pq;
+        // Key i is the pair (i, next[i]); ties on the sum go to the leftmost.
+        IndexedHeap<pair<long long, int>> pq(n);
 
         for (int i = 0; i + 1 < n; i++) {
-            pq.push({a[i] + a[i + 1], i});
+            pq.push(i, {node[i].a + node[i + 1].a, i});
         }
 
         int bad = 0;
 
         for (int i = 0; i + 1 < n; i++) {
-            if (a[i] > a[i + 1])
+            if (node[i].a > node[i + 1].a)
                 bad++;
         }
 
@@ -86,44 +224,35 @@ public:
 
         while (bad > 0) {
 
-            auto [sum, i] = pq.top();
-            pq.pop();
-
-            if (!alive[i])
-                continue;
-
-            int j = next[i];
+            int i = pq.top();
+            int j = node[i].next;
 
-            if (j == -1 || !alive[j])
-                continue;
+            int pi = node[i].prev;
+            int nj = node[j].next;
 
-            if (a[i] + a[j] != sum)
-                continue;
+            if (pi != -1 && node[pi].a > node[i].a) bad--;
+            if (node[i].a > node[j].a) bad--;
+            if (nj != -1 && node[j].a > node[nj].a) bad--;
 
-            int pi = prev[i];
-            int nj = next[j];
+            node[i].a += node[j].a;
 
-            if (pi != -1 && a[pi] > a[i]) bad--;
-            if (a[i] > a[j]) bad--;
-            if (nj != -1 && a[j] > a[nj]) bad--;
-
-            a[i] += a[j];
-
-            alive[j] = false;
-
-            next[i] = nj;
+            node[i].next = nj;
 
             if (nj != -1)
-                prev[nj] = i;
+                node[nj].prev = i;
+
+            if (pi != -1 && node[pi].a > node[i].a) bad++;
+            if (nj != -1 && node[i].a > node[nj].a) bad++;
 
-            if (pi != -1 && a[pi] > a[i]) bad++;
-            if (nj != -1 && a[i] > a[nj]) bad++;
+            pq.erase(j);
 
             if (pi != -1)
-                pq.push({a[pi] + a[i], pi});
+                pq.update(pi, {node[pi].a + node[i].a, pi});
 
             if (nj != -1)
-                pq.push({a[i] + a[nj], i});
+                pq.update(i, {node[i].a + node[nj].a, i});
+            else
+                pq.erase(i);
 
             operations++;
         }
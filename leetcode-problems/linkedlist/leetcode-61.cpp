@@ -24,7 +24,7 @@ Output: [2,0,1]
 - 0 <= k <= 2 * 10^9
 
 ⏰ TIME COMPLEXITY: O(N)
-💾 SPACE COMPLEXITY: O(N)
+💾 SPACE COMPLEXITY: O(1) [nodes are relinked in place]
 */
 
 /**
@@ -45,30 +45,30 @@ public:
         if(head == NULL || head->next == NULL)
             return head;
 
-        vector<int> nums;
+        int n = 1;
+        ListNode* tail = head;
 
-        while(head != NULL){
-            nums.push_back(head->val);
-            head = head->next;
+        while(tail->next != NULL){
+            tail = tail->next;
+            n++;
         }
 
-        k = k % nums.size();
+        k = k % n;
 
-        reverse(nums.begin(), nums.end());
-        reverse(nums.begin(), nums.begin() + k);
-        reverse(nums.begin() + k, nums.end());
+        if(k == 0)
+            return head;
 
-        ListNode* newhead = new ListNode(nums[0]);
-        ListNode* temp = newhead;
+        ListNode* newTail = head;
 
-        for(int i = 1; i < nums.size(); i++){
+        for(int i = 1; i < n - k; i++){
+            newTail = newTail->next;
+        }
 
-            ListNode* newNode = new ListNode(nums[i]);
+        ListNode* newHead = newTail->next;
 
-            temp->next = newNode;
-            temp = newNode;
-        }
+        newTail->next = NULL;
+        tail->next = head;
 
-        return newhead;
+        return newHead;
     }
 };
\ No newline at end of file
@@ -25,8 +25,8 @@ Output: [2,3]
 - -100 <= Node.val <= 100
 - The list is guaranteed to be sorted in ascending order
 
-⏰ TIME COMPLEXITY: O(N log N)
-💾 SPACE COMPLEXITY: O(N)
+⏰ TIME COMPLEXITY: O(N)
+💾 SPACE COMPLEXITY: O(1)
 */
 
 /**
@@ -40,31 +40,92 @@ Output: [2,3]
  * };
  */
 
+// Same filter for sorted streams that do not fit in memory: values arrive
+// in chunks of any size (e.g. blocks read from a sorted file) and every
+// value that occurs exactly once is passed to emit. Only the current value
+// and its run length are kept between chunks.
+class SortedUniqueStream {
+public:
+    template <class Emit>
+    void feed(span<const int> chunk, Emit&& emit) {
+
+        for(int v : chunk){
+
+            if(run > 0 && v == current){
+                run++;
+                continue;
+            }
+
+            if(run == 1){
+                emit(current);
+            }
+
+            current = v;
+            run = 1;
+        }
+    }
+
+    template <class Emit>
+    void finish(Emit&& emit) {
+
+        if(run == 1){
+            emit(current);
+        }
+
+        run = 0;
+    }
+
+private:
+    int current = 0;
+    long long run = 0;
+};
+
+template <class InputIt, class OutputIt>
+OutputIt copyUniqueSorted(InputIt first, InputIt last, OutputIt out) {
+
+    while(first != last){
+
+        int v = *first;
+        bool single = true;
+
+        while(++first != last && *first == v){
+            single = false;
+        }
+
+        if(single){
+            *out++ = v;
+        }
+    }
+
+    return out;
+}
+
 class Solution {
 public:
     ListNode* deleteDuplicates(ListNode* head) {
 
-        map<int,int> mp;
+        ListNode dummy(-1, head);
+        ListNode* tail = &dummy;
 
         while(head != NULL){
-            mp[head->val]++;
-            head = head->next;
-        }
 
-        ListNode* newhead = new ListNode(-1);
-        ListNode* temp = newhead;
+            if(head->next != NULL && head->next->val == head->val){
 
-        for(auto it : mp){
+                int dup = head->val;
 
-            if(it.second == 1){
+                while(head != NULL && head->val == dup){
+                    head = head->next;
+                }
 
-                ListNode* node = new ListNode(it.first);
+                tail->next = head;
+            }
+            else {
 
-                temp->next = node;
-                temp = node;
+                tail = head;
+                head = head->next;
             }
         }
 
-        return newhead->next;
+        return dummy.next;
     }
 };
\ No newline at end of file
@@ -27,7 +27,7 @@ Output: [5]
 - 1 <= left <= right <= n
 
 ⏰ TIME COMPLEXITY: O(N)
-💾 SPACE COMPLEXITY: O(N)
+💾 SPACE COMPLEXITY: O(1)
 */
 
 /**
@@ -45,31 +45,26 @@ class Solution {
 public:
     ListNode* reverseBetween(ListNode* head, int left, int right) {
 
-        vector<int> arr;
+        ListNode dummy(-1, head);
 
-        ListNode* temp = head;
+        ListNode* prev = &dummy;
 
-        while(temp != NULL){
-
-            arr.push_back(temp->val);
-            temp = temp->next;
+        for(int i = 1; i < left; i++){
+            prev = prev->next;
         }
 
-        reverse(arr.begin() + left - 1, arr.begin() + right);
-
-        ListNode* newHead = new ListNode(-1);
-
-        ListNode* curr = newHead;
-
-        for(int i = 0; i < arr.size(); i++){
+        ListNode* curr = prev->next;
 
-            ListNode* node = new ListNode(arr[i]);
+        // Move each following node to the front of the reversed section.
+        for(int i = left; i < right; i++){
 
-            curr->next = node;
+            ListNode* node = curr->next;
 
-            curr = curr->next;
+            curr->next = node->next;
+            node->next = prev->next;
+            prev->next = node;
         }
 
-        return newHead->next;
+        return dummy.next;
     }
 };
\ No newline at end of file
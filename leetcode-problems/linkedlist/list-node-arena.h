@@ -0,0 +1,93 @@
+/*
+╔══════════════════════════════════════════════════════════════════════════════╗
+║                           SHARED LINKED LIST UTILITY                         ║
+╠══════════════════════════════════════════════════════════════════════════════╣
+║ Component     : ListNodeArena                                                ║
+║ Used By       : linkedlist/ solutions, local tests and benchmarks            ║
+║ Topic         : Linked List, Memory Management                               ║
+╚══════════════════════════════════════════════════════════════════════════════╝
+
+📋 DESCRIPTION:
+Bump allocator for ListNode. Nodes are carved out of fixed-size slabs, so
+building a list of n nodes costs about n / slabSize heap allocations
+instead of n, and the nodes end up contiguous in memory.
+
+reset() rewinds to the first slab without freeing anything, so a list of
+the same size can be rebuilt with zero new heap allocations. Every node
+handed out before a reset() becomes invalid.
+
+ListNode is trivially destructible, so no destructors are ever run.
+
+⏰ TIME COMPLEXITY: O(1) amortized per node
+💾 SPACE COMPLEXITY: O(peak nodes)
+*/
+
+#pragma once
+
+class ListNodeArena {
+public:
+    explicit ListNodeArena(size_t slabSize = 4096) : slabSize(slabSize) {}
+
+    ListNodeArena(const ListNodeArena&) = delete;
+    ListNodeArena& operator=(const ListNodeArena&) = delete;
+
+    ~ListNodeArena() {
+        for (ListNode* slab : slabs) {
+            ::operator delete(slab);
+        }
+    }
+
+    ListNode* make(int val, ListNode* next = nullptr) {
+
+        if (used == slabSize || slabs.empty()) {
+            nextSlab();
+        }
+
+        return new (slabs[current] + used++) ListNode(val, next);
+    }
+
+    ListNode* build(const vector<int>& values) {
+
+        ListNode dummy;
+        ListNode* tail = &dummy;
+
+        for (int v : values) {
+            tail->next = make(v);
+            tail = tail->next;
+        }
+
+        return dummy.next;
+    }
+
+    void reset() {
+        current = 0;
+        used = 0;
+    }
+
+    // Number of slabs requested from the heap over the arena's lifetime.
+    size_t heapAllocations() const {
+        return allocations;
+    }
+
+private:
+    vector<ListNode*> slabs;
+
+    size_t slabSize;
+    size_t current = 0;
+    size_t used = 0;
+    size_t allocations = 0;
+
+    void nextSlab() {
+
+        if (!slabs.empty()) {
+            current++;
+        }
+
+        used = 0;
+
+        if (current == slabs.size()) {
+            slabs.push_back(static_cast<ListNode*>(::operator new(slabSize * sizeof(ListNode))));
+            allocations++;
+        }
+    }
+};
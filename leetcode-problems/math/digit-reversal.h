@@ -0,0 +1,231 @@
+/*
+╔══════════════════════════════════════════════════════════════════════════════╗
+║                             SHARED MATH UTILITY                              ║
+╠══════════════════════════════════════════════════════════════════════════════╣
+║ Component     : DigitReversal                                                ║
+║ Used By       : leetcode-7.cpp, leetcode-9.cpp                               ║
+║ Topic         : Math, Lookup Tables, SIMD                                    ║
+╚══════════════════════════════════════════════════════════════════════════════╝
+
+📋 DESCRIPTION:
+Batch decimal digit reversal for int32 / int64 values.
+
+Scalar path: the magnitude is split into 4-digit groups (division by the
+constant 10000 compiles to a multiply and a shift) and each full group is
+reversed with one lookup; the last, shorter group uses a second table that
+also gives its digit count.
+
+AVX2 path (int32): 8 values per iteration, one digit per step, with the
+division by 10 done as a 32x32->64 multiply by 0xCCCCCCCD and a shift.
+
+Overflow semantics match LeetCode 7: a reversal that does not fit the
+input type yields 0. A value is a palindrome iff it is non-negative and
+equal to its reversal; an overflowing reversal is never equal to x.
+
+⏰ TIME COMPLEXITY: O(digits / 4) per value (scalar), O(digits) per 8 values (AVX2)
+💾 SPACE COMPLEXITY: O(1) [two 10^4-entry tables]
+*/
+
+#pragma once
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define DIGIT_REVERSAL_X86 1
+#endif
+
+class DigitReversal {
+public:
+    static int32_t reverse32(int32_t x) {
+
+        uint64_t r = reverseMagnitude(magnitude(x));
+
+        if (x >= 0) {
+            return r > (uint64_t)INT32_MAX ? 0 : (int32_t)r;
+        }
+
+        return r > (uint64_t)INT32_MAX + 1 ? 0 : (int32_t)(0 - r);
+    }
+
+    static int64_t reverse64(int64_t x) {
+
+        // 19-digit magnitudes reverse to at most 9999999999999999999,
+        // which still fits in uint64_t.
+        uint64_t r = reverseMagnitude(magnitude(x));
+
+        if (x >= 0) {
+            return r > (uint64_t)INT64_MAX ? 0 : (int64_t)r;
+        }
+
+        return r > (uint64_t)INT64_MAX + 1 ? 0 : (int64_t)(0 - r);
+    }
+
+    static void reverseBatch(span<const int32_t> in, span<int32_t> out) {
+
+        size_t i = 0;
+
+#ifdef DIGIT_REVERSAL_X86
+        if (hasAvx2()) {
+            i = reverseAvx2(in.data(), out.data(), nullptr, in.size());
+        }
+#endif
+
+        for (; i < in.size(); i++) {
+            out[i] = reverse32(in[i]);
+        }
+    }
+
+    static void reverseBatch(span<const int64_t> in, span<int64_t> out) {
+        for (size_t i = 0; i < in.size(); i++) {
+            out[i] = reverse64(in[i]);
+        }
+    }
+
+    static void palindromeBatch(span<const int32_t> in, span<uint8_t> out) {
+
+        size_t i = 0;
+
+#ifdef DIGIT_REVERSAL_X86
+        if (hasAvx2()) {
+            i = reverseAvx2(in.data(), nullptr, out.data(), in.size());
+        }
+#endif
+
+        for (; i < in.size(); i++) {
+            out[i] = in[i] >= 0 && reverse32(in[i]) == in[i];
+        }
+    }
+
+    static void palindromeBatch(span<const int64_t> in, span<uint8_t> out) {
+        for (size_t i = 0; i < in.size(); i++) {
+            out[i] = in[i] >= 0 && reverse64(in[i]) == in[i];
+        }
+    }
+
+private:
+    struct Tables {
+        uint16_t rev4[10000];
+        uint16_t revShort[10000];
+        uint8_t len[10000];
+        uint64_t pow10[5];
+
+        Tables() {
+
+            pow10[0] = 1;
+
+            for (int i = 1; i < 5; i++) {
+                pow10[i] = pow10[i - 1] * 10;
+            }
+
+            for (int v = 0; v < 10000; v++) {
+
+                int r = 0;
+                int d = 0;
+
+                for (int x = v; x > 0; x /= 10) {
+                    r = r * 10 + x % 10;
+                    d++;
+                }
+
+                revShort[v] = r;
+                len[v] = max(d, 1);
+                rev4[v] = (v % 10) * 1000 + (v / 10 % 10) * 100 + (v / 100 % 10) * 10 + v / 1000;
+            }
+        }
+    };
+
+    static const Tables& tables() {
+        static const Tables t;
+        return t;
+    }
+
+    template <class T>
+    static uint64_t magnitude(T x) {
+        using U = make_unsigned_t<T>;
+        return x < 0 ? (uint64_t)(U(0) - U(x)) : (uint64_t)x;
+    }
+
+    static uint64_t reverseMagnitude(uint64_t m) {
+
+        const Tables& t = tables();
+
+        uint64_t r = 0;
+
+        while (m >= 10000) {
+
+            uint64_t q = m / 10000;
+
+            r = r * 10000 + t.rev4[m - q * 10000];
+            m = q;
+        }
+
+        return r * t.pow10[t.len[m]] + t.revShort[m];
+    }
+
+#ifdef DIGIT_REVERSAL_X86
+    static bool hasAvx2() {
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+    }
+
+    // Writes reversals to rev, or palindrome flags to pal, for the largest
+    // multiple of 8 values; returns how many were processed.
+    __attribute__((target("avx2")))
+    static size_t reverseAvx2(const int32_t* in, int32_t* rev, uint8_t* pal, size_t n) {
+
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i ten = _mm256_set1_epi32(10);
+        const __m256i magic = _mm256_set1_epi32((int)0xCCCCCCCD);
+        const __m256i limit = _mm256_set1_epi32(INT32_MAX / 10);
+
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8) {
+
+            __m256i x = _mm256_loadu_si256((const __m256i*)(in + i));
+
+            // abs(INT32_MIN) stays 0x80000000, the correct unsigned magnitude.
+            __m256i m = _mm256_abs_epi32(x);
+            __m256i r = zero;
+            __m256i over = zero;
+
+            while (!_mm256_testz_si256(m, m)) {
+
+                __m256i qEven = _mm256_srli_epi64(_mm256_mul_epu32(m, magic), 35);
+                __m256i qOdd = _mm256_srli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(m, 32), magic), 35);
+                __m256i q = _mm256_blend_epi32(qEven, _mm256_slli_epi64(qOdd, 32), 0xAA);
+
+                __m256i digit = _mm256_sub_epi32(m, _mm256_mullo_epi32(q, ten));
+                __m256i active = _mm256_xor_si256(_mm256_cmpeq_epi32(m, zero), _mm256_set1_epi32(-1));
+
+                // Same test as the scalar loop: appending another digit to a
+                // value above INT32_MAX / 10 overflows. r never exceeds
+                // INT32_MAX before that, so a signed compare is safe.
+                over = _mm256_or_si256(over, _mm256_and_si256(active, _mm256_cmpgt_epi32(r, limit)));
+
+                __m256i next = _mm256_add_epi32(_mm256_mullo_epi32(r, ten), digit);
+
+                r = _mm256_blendv_epi8(r, next, active);
+                m = q;
+            }
+
+            if (rev != nullptr) {
+                __m256i signedR = _mm256_sign_epi32(r, x);
+                _mm256_storeu_si256((__m256i*)(rev + i), _mm256_andnot_si256(over, signedR));
+            }
+            else {
+
+                __m256i isPal = _mm256_andnot_si256(over, _mm256_cmpeq_epi32(r, x));
+                isPal = _mm256_andnot_si256(_mm256_cmpgt_epi32(zero, x), isPal);
+
+                unsigned mask = _mm256_movemask_ps(_mm256_castsi256_ps(isPal));
+
+                for (int l = 0; l < 8; l++) {
+                    pal[i + l] = (mask >> l) & 1;
+                }
+            }
+        }
+
+        return i;
+    }
+#endif
+};
@@ -11,10 +11,157 @@
 📋 PROBLEM STATEMENT:
 Return the kth factor of n in sorted order, or -1 if it doesn't exist.
 
-⏰ TIME COMPLEXITY: O(√n)
-💾 SPACE COMPLEXITY: O(1)
+⏰ TIME COMPLEXITY: O(√n) per call; FactorIndex: O(N) build,
+                   O(log n + d(n) log d(n)) per uncached query, O(1) cached
+💾 SPACE COMPLEXITY: O(1) per call; FactorIndex: O(N) sieve + LRU
 */
 
+// Answers many kthFactor queries for 1 <= n <= maxN; other n throw
+// out_of_range. A linear smallest-prime-factor sieve is built once, so
+// factorizing n takes O(log n) lookups and its sorted divisor list is
+// generated from the exponents with no trial division. The most recently
+// expanded lists are kept in an LRU cache of cacheCapacity entries; a
+// capacity of 0 disables caching.
+//
+// Not thread-safe: queries update the cache.
+class FactorIndex {
+public:
+    FactorIndex(int maxN, size_t cacheCapacity = 1024) : spf(maxN + 1, 0), capacity(cacheCapacity) {
+
+        vector<int> primes;
+
+        for (int i = 2; i <= maxN; i++) {
+
+            if (spf[i] == 0) {
+                spf[i] = i;
+                primes.push_back(i);
+            }
+
+            for (int p : primes) {
+
+                if (p > spf[i] || (long long)p * i > maxN) {
+                    break;
+                }
+
+                spf[p * i] = p;
+            }
+        }
+    }
+
+    int kthFactor(int n, int k) {
+
+        // d(n) comes straight from the exponents, so out-of-range k never
+        // expands the list.
+        int count = divisorCount(n);
+
+        if (k < 1 || k > count) {
+            return -1;
+        }
+
+        return capacity == 0 ? expand(n)[k - 1] : lookup(n)[k - 1];
+    }
+
+    // Returns a copy: a reference into the cache would be invalidated by
+    // the next query that evicts it.
+    vector<int> divisors(int n) {
+
+        checkRange(n);
+
+        return capacity == 0 ? expand(n) : lookup(n);
+    }
+
+    int divisorCount(int n) const {
+
+        checkRange(n);
+
+        int count = 1;
+
+        while (n > 1) {
+
+            int p = spf[n];
+            int e = 0;
+
+            while (n % p == 0) {
+                n /= p;
+                e++;
+            }
+
+            count *= e + 1;
+        }
+
+        return count;
+    }
+
+private:
+    vector<int> spf;
+
+    size_t capacity;
+    list<pair<int, vector<int>>> order;
+    unordered_map<int, list<pair<int, vector<int>>>::iterator> cache;
+
+    void checkRange(int n) const {
+
+        if (n < 1 || n >= (int)spf.size()) {
+            throw out_of_range("FactorIndex: n outside [1, maxN]");
+        }
+    }
+
+    // Cached divisor list of n; only valid until the next lookup.
+    // Requires capacity > 0.
+    const vector<int>& lookup(int n) {
+
+        auto it = cache.find(n);
+
+        if (it != cache.end()) {
+            order.splice(order.begin(), order, it->second);
+            return it->second->second;
+        }
+
+        if (cache.size() >= capacity) {
+            cache.erase(order.back().first);
+            order.pop_back();
+        }
+
+        order.emplace_front(n, expand(n));
+        cache[n] = order.begin();
+
+        return order.front().second;
+    }
+
+    vector<int> expand(int n) const {
+
+        vector<int> result = {1};
+
+        while (n > 1) {
+
+            int p = spf[n];
+            int e = 0;
+
+            while (n % p == 0) {
+                n /= p;
+                e++;
+            }
+
+            size_t base = result.size();
+
+            int power = 1;
+
+            for (int j = 0; j < e; j++) {
+
+                power *= p;
+
+                for (size_t i = 0; i < base; i++) {
+                    result.push_back(result[i] * power);
+                }
+            }
+        }
+
+        sort(result.begin(), result.end());
+
+        return result;
+    }
+};
+
 class Solution {
 public:
     int kthFactor(int n, int k) {
@@ -45,4 +192,63 @@ public:
 
         return -1;
     }
-};
\ No newline at end of file
+};
+
+// FactorIndex against per-call trial division on the same (n, k) queries:
+// once with n uniform over [1, maxN] (mostly cache misses) and once with n
+// drawn from 512 hot values (mostly cache hits).
+void benchmarkFactorIndex(int maxN = 10000000, int queries = 1000000) {
+
+    mt19937 rng(42);
+
+    auto t0 = chrono::steady_clock::now();
+
+    FactorIndex index(maxN);
+
+    double buildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+
+    printf("build=%.1fms\n", buildMs);
+
+    vector<int> hot(512);
+
+    for (int& h : hot) {
+        h = rng() % maxN + 1;
+    }
+
+    for (int pass = 0; pass < 2; pass++) {
+
+        vector<pair<int, int>> qs(queries);
+
+        for (auto& [n, k] : qs) {
+            n = pass == 0 ? rng() % maxN + 1 : hot[rng() % hot.size()];
+            k = rng() % 32 + 1;
+        }
+
+        Solution solution;
+
+        auto t1 = chrono::steady_clock::now();
+
+        long long expected = 0;
+
+        for (auto [n, k] : qs) {
+            expected += solution.kthFactor(n, k);
+        }
+
+        auto t2 = chrono::steady_clock::now();
+
+        long long actual = 0;
+
+        for (auto [n, k] : qs) {
+            actual += index.kthFactor(n, k);
+        }
+
+        auto t3 = chrono::steady_clock::now();
+
+        double perCallMs = chrono::duration<double, milli>(t2 - t1).count();
+        double indexMs = chrono::duration<double, milli>(t3 - t2).count();
+
+        printf("%s  per-call=%.1fms  index=%.1fms  speedup=%.2fx  %s\n",
+               pass == 0 ? "uniform" : "hot    ", perCallMs, indexMs, perCallMs / indexMs,
+               expected == actual ? "ok" : "MISMATCH");
+    }
+}
\ No newline at end of file
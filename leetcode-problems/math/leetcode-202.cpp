@@ -12,10 +12,154 @@
 A number is happy if repeatedly replacing it with sum of squares of digits
 eventually leads to 1. Otherwise it falls into a cycle.
 
-⏰ TIME COMPLEXITY: O(log n)
+⏰ TIME COMPLEXITY: O(log n) per isHappy; O(1) per value with HappyClassifier
 💾 SPACE COMPLEXITY: O(1)
 */
 
+// One digit-square step maps any value below 10^12 to at most
+// 12 * 9² = 972, so the fate of every such value is decided by the fate
+// of 0..972. Those are computed once; afterwards a value costs three
+// lookups into a table of digit-square sums of 4-digit groups.
+//
+// Ranges are walked in aligned blocks of 10^4: the upper digits are fixed
+// within a block, so each value costs one lookup plus one add. Range
+// bounds must not exceed MAX_VALUE; larger ones throw out_of_range.
+class HappyClassifier {
+public:
+    static const int LIMIT = 12 * 81;
+    static constexpr uint64_t MAX_VALUE = 1000000000000ULL;
+
+    HappyClassifier() {
+
+        for (int v = 0; v < 10000; v++) {
+            sq4[v] = square(v % 10) + square(v / 10 % 10) + square(v / 100 % 10) + square(v / 1000);
+        }
+
+        for (int v = 0; v <= LIMIT; v++) {
+
+            int slow = v;
+            int fast = v;
+
+            do {
+                slow = step(slow);
+                fast = step(step(fast));
+            } while (slow != fast);
+
+            happy[v] = slow == 1;
+        }
+    }
+
+    bool isHappy(uint32_t n) const {
+        return n <= LIMIT ? happy[n] : happy[step(n)];
+    }
+
+    void classify(span<const uint32_t> values, span<uint8_t> out, int threads = 0) const {
+
+        parallelFor(values.size(), threads, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) {
+                out[i] = isHappy(values[i]);
+            }
+        });
+    }
+
+    // out[i] = isHappy(lo + i) for every value in [lo, hi).
+    void classifyRange(uint64_t lo, uint64_t hi, span<uint8_t> out, int threads = 0) const {
+
+        checkRange(lo, hi);
+
+        parallelFor(hi - lo, threads, [&](size_t a, size_t b) {
+            walkRange(lo + a, lo + b, [&](uint64_t n, bool h) {
+                out[n - lo] = h;
+            });
+        });
+    }
+
+    uint64_t countRange(uint64_t lo, uint64_t hi, int threads = 0) const {
+
+        checkRange(lo, hi);
+
+        atomic<uint64_t> total(0);
+
+        parallelFor(hi - lo, threads, [&](size_t a, size_t b) {
+
+            uint64_t count = 0;
+
+            walkRange(lo + a, lo + b, [&](uint64_t, bool h) {
+                count += h;
+            });
+
+            total += count;
+        });
+
+        return total.load();
+    }
+
+private:
+    uint16_t sq4[10000];
+    bool happy[LIMIT + 1];
+
+    static int square(int d) {
+        return d * d;
+    }
+
+    int step(uint64_t n) const {
+        return sq4[n % 10000] + sq4[n / 10000 % 10000] + sq4[n / 100000000];
+    }
+
+    // Values must stay below 10^12 so that three 4-digit groups cover them
+    // and their digit-square sum indexes happy[].
+    static void checkRange(uint64_t lo, uint64_t hi) {
+
+        if (lo > hi || hi > MAX_VALUE) {
+            throw out_of_range("HappyClassifier: range must satisfy lo <= hi <= 10^12");
+        }
+    }
+
+    template <class Visit>
+    void walkRange(uint64_t lo, uint64_t hi, Visit&& visit) const {
+
+        uint64_t n = lo;
+
+        while (n < hi) {
+
+            uint64_t block = n / 10000;
+            uint64_t end = min(hi, (block + 1) * 10000);
+
+            int upper = sq4[block % 10000] + sq4[block / 10000 % 10000];
+
+            for (; n < end; n++) {
+
+                int s = upper + sq4[n % 10000];
+
+                visit(n, n <= LIMIT ? happy[n] : happy[s]);
+            }
+        }
+    }
+
+    template <class Task>
+    static void parallelFor(size_t n, int threads, Task&& task) {
+
+        if (threads <= 0) {
+            threads = n < (1 << 20) ? 1 : max(1u, thread::hardware_concurrency());
+        }
+
+        size_t chunk = (n + threads - 1) / threads;
+
+        vector<thread> pool;
+
+        for (int t = 1; t < threads; t++) {
+            size_t lo = min(n, t * chunk);
+            pool.emplace_back(task, lo, min(n, lo + chunk));
+        }
+
+        task(0, min(n, chunk));
+
+        for (thread& th : pool) {
+            th.join();
+        }
+    }
+};
+
 class Solution {
 public:
 
@@ -45,4 +189,42 @@ public:
 
         return slow == 1;
     }
-};
\ No newline at end of file
+};
+
+// Counts the happy numbers in [1, n] with HappyClassifier, then times the
+// per-call Floyd isHappy on an evenly spaced sample of those values (the
+// full range would take minutes) and checks both agree on the sample.
+void benchmarkHappyClassifier(uint64_t n = 1000000000, int threads = 0) {
+
+    auto t0 = chrono::steady_clock::now();
+
+    HappyClassifier classifier;
+
+    auto t1 = chrono::steady_clock::now();
+
+    uint64_t happyCount = classifier.countRange(1, n + 1, threads);
+
+    auto t2 = chrono::steady_clock::now();
+
+    const int SAMPLE = 10000000;
+    uint64_t stride = max<uint64_t>(1, n / SAMPLE);
+
+    Solution solution;
+    int sampled = 0;
+    int mismatches = 0;
+
+    for (uint64_t v = 1; v <= n && v <= INT_MAX; v += stride) {
+        mismatches += solution.isHappy((int)v) != classifier.isHappy((uint32_t)v);
+        sampled++;
+    }
+
+    auto t3 = chrono::steady_clock::now();
+
+    double buildUs = chrono::duration<double, micro>(t1 - t0).count();
+    double rangeNs = chrono::duration<double, nano>(t2 - t1).count() / n;
+    double floydNs = chrono::duration<double, nano>(t3 - t2).count() / sampled;
+
+    printf("n=%llu  happy=%llu  build=%.1fus  classifier=%.3fns/value  floyd=%.3fns/value  %s\n",
+           (unsigned long long)n, (unsigned long long)happyCount, buildUs, rangeNs, floydNs,
+           mismatches == 0 ? "ok" : "MISMATCH");
+}
\ No newline at end of file
@@ -12,10 +12,117 @@
 Divide two integers without using *, /, or % operators.
 Result must truncate toward zero and handle 32-bit overflow.
 
-⏰ TIME COMPLEXITY: O(log n)
+⏰ TIME COMPLEXITY: O(log² n) per divide(); O(1) per value with FastDivider
 💾 SPACE COMPLEXITY: O(1)
 */
 
+// Division by a divisor that stays fixed over many dividends. The
+// constructor precomputes a magic multiplier m and shift, after which
+// n / d is a multiply-high plus a few adds and shifts (Granlund-Montgomery
+// round-up method):
+//
+//   t = mulhi(m, n);  q = (t + ((n - t) >> 1)) >> (shift - 1)
+//
+// Powers of two reduce to a plain shift. Signed types divide the unsigned
+// magnitude and restore the sign, giving C++ truncation toward zero; the
+// one overflowing case, MIN / -1, wraps to MIN instead of trapping. A zero
+// divisor throws invalid_argument.
+template <class T>
+class FastDivider {
+public:
+    using U = make_unsigned_t<T>;
+
+    explicit FastDivider(T divisor) {
+
+        if (divisor == 0) {
+            throw invalid_argument("FastDivider: division by zero");
+        }
+
+        negative = is_signed_v<T> && divisor < 0;
+        U d = negative ? U(0) - U(divisor) : U(divisor);
+
+        int bits = numeric_limits<U>::digits;
+        int floorLog = bits - 1 - countLeadingZeros(d);
+
+        if ((d & (d - 1)) == 0) {
+            pow2 = true;
+            shift = floorLog;
+            return;
+        }
+
+        // l = ceil(log2 d); (2^l - d) is computed mod 2^bits so that
+        // l == bits still works.
+        shift = floorLog + 1;
+
+        U diff = U(U(U(1) << (shift - 1)) * 2 - d);
+
+        magic = U((Wide(diff) << bits) / d) + 1;
+    }
+
+    T divide(T n) const {
+        return pow2 ? divideWith<true>(n) : divideWith<false>(n);
+    }
+
+    // The power-of-two test is hoisted out of the loop and the sign fix-up
+    // is branch-free, so the compiler can vectorize the body.
+    void divide(span<const T> in, span<T> out) const {
+
+        if (pow2) {
+            for (size_t i = 0; i < in.size(); i++) {
+                out[i] = divideWith<true>(in[i]);
+            }
+        }
+        else {
+            for (size_t i = 0; i < in.size(); i++) {
+                out[i] = divideWith<false>(in[i]);
+            }
+        }
+    }
+
+private:
+    using Wide = conditional_t<sizeof(U) <= 4, uint64_t, unsigned __int128>;
+
+    U magic = 0;
+    int shift = 0;
+    bool pow2 = false;
+    bool negative = false;
+
+    static int countLeadingZeros(U x) {
+        if constexpr (sizeof(U) <= 4) {
+            return __builtin_clz((uint32_t)x) - (32 - numeric_limits<U>::digits);
+        }
+        else {
+            return __builtin_clzll((uint64_t)x);
+        }
+    }
+
+    template <bool POW2>
+    T divideWith(T n) const {
+
+        // All ones when n is negative, zero otherwise.
+        U sign = 0;
+
+        if constexpr (is_signed_v<T>) {
+            sign = U(n >> (numeric_limits<T>::digits));
+        }
+
+        U x = U(U(n) ^ sign) - sign;
+        U q;
+
+        if constexpr (POW2) {
+            q = x >> shift;
+        }
+        else {
+            U t = U((Wide(magic) * x) >> numeric_limits<U>::digits);
+            q = U((t + U(U(x - t) >> 1)) >> (shift - 1));
+        }
+
+        U flip = sign ^ (negative ? U(~U(0)) : U(0));
+
+        return T(U(q ^ flip) - flip);
+    }
+};
+
 class Solution {
 public:
     int divide(int dividend, int divisor) {
@@ -48,4 +155,74 @@ public:
 
         return (int)result;
     }
-};
\ No newline at end of file
+
+    // Many dividends over one divisor, with the same INT_MIN / -1 rule. A
+    // zero divisor throws invalid_argument from FastDivider before any
+    // output is written.
+    void divideBatch(span<const int> dividends, int divisor, span<int> out) {
+
+        // -1 is the only divisor that can overflow; handle it once so the
+        // general case stays a single branch-free batch loop.
+        if (divisor == -1) {
+            for (size_t i = 0; i < dividends.size(); i++) {
+                out[i] = dividends[i] == INT_MIN ? INT_MAX : -dividends[i];
+            }
+            return;
+        }
+
+        FastDivider<int> div(divisor);
+
+        div.divide(dividends, out);
+    }
+};
+
+// FastDivider against hardware division and the shift-subtract divide()
+// on the same random dividends, for a few fixed divisors. divide() is
+// much slower, so it runs on the first 1/16 of the input; all figures are
+// nanoseconds per value.
+void benchmarkFastDivider(size_t n = 1 << 24) {
+
+    mt19937 rng(42);
+
+    vector<int> in(n);
+
+    for (int& x : in) {
+        x = (int)rng();
+    }
+
+    const int divisors[] = {3, -7, 10, 1000, 1 << 12, -65537, 123456789};
+
+    vector<int> hardware(n), fast(n), slow(n / 16);
+
+    Solution solution;
+
+    for (int d : divisors) {
+
+        auto t0 = chrono::steady_clock::now();
+
+        for (size_t i = 0; i < n; i++) {
+            hardware[i] = in[i] / d;
+        }
+
+        auto t1 = chrono::steady_clock::now();
+
+        solution.divideBatch(in, d, fast);
+
+        auto t2 = chrono::steady_clock::now();
+
+        for (size_t i = 0; i < slow.size(); i++) {
+            slow[i] = solution.divide(in[i], d);
+        }
+
+        auto t3 = chrono::steady_clock::now();
+
+        bool same = hardware == fast && equal(slow.begin(), slow.end(), hardware.begin());
+
+        double hardwareNs = chrono::duration<double, nano>(t1 - t0).count() / n;
+        double fastNs = chrono::duration<double, nano>(t2 - t1).count() / n;
+        double slowNs = chrono::duration<double, nano>(t3 - t2).count() / slow.size();
+
+        printf("d=%10d  idiv=%.3fns  fast=%.3fns  divide()=%.3fns  %s\n",
+               d, hardwareNs, fastNs, slowNs, same ? "ok" : "MISMATCH");
+    }
+}
\ No newline at end of file
@@ -16,6 +16,8 @@ If reversing causes overflow outside [-2^31, 2^31 - 1], return 0.
 💾 SPACE COMPLEXITY: O(1)
 */
 
+#include "digit-reversal.h"
+
 class Solution {
 public:
     int reverse(int x) {
@@ -36,4 +38,13 @@ public:
 
         return res;
     }
+
+    // Bulk form for many values; same overflow rule (0 when out of range).
+    void reverseBatch(span<const int32_t> in, span<int32_t> out) {
+        DigitReversal::reverseBatch(in, out);
+    }
+
+    void reverseBatch(span<const int64_t> in, span<int64_t> out) {
+        DigitReversal::reverseBatch(in, out);
+    }
 };
\ No newline at end of file
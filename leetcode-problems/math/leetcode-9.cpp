@@ -17,6 +17,8 @@ A palindrome reads the same forward and backward.
 💾 SPACE COMPLEXITY: O(1)
 */
 
+#include "digit-reversal.h"
+
 class Solution {
 public:
     bool isPalindrome(int x) {
@@ -34,4 +36,12 @@ public:
         
         return (x == reversedHalf || x == reversedHalf / 10);
     }
+
+    void isPalindromeBatch(span<const int32_t> in, span<uint8_t> out) {
+        DigitReversal::palindromeBatch(in, out);
+    }
+
+    void isPalindromeBatch(span<const int64_t> in, span<uint8_t> out) {
+        DigitReversal::palindromeBatch(in, out);
+    }
 };
\ No newline at end of file
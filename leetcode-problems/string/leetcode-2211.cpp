@@ -0,0 +1,258 @@
+/*
+╔══════════════════════════════════════════════════════════════════════════════╗
+║                          LEETCODE PROBLEM SOLUTION                           ║
+╠══════════════════════════════════════════════════════════════════════════════╣
+║ Problem ID    : 2211                                                         ║
+║ Problem Name  : Count Collisions on a Road                                   ║
+║ Difficulty    : Medium                                                       ║
+║ Topic         : String, Stack, Simulation                                    ║
+╚══════════════════════════════════════════════════════════════════════════════╝
+
+📋 PROBLEM STATEMENT:
+Count total collisions among cars moving Left (L), Right (R), or Stationary (S).
+
+💡 IDEA:
+- Cars in the leading run of 'L' and the trailing run of 'R' drive off
+  the road; every other moving car hits something and stops, adding one
+  collision each
+- answer = (non-'S' cars) - (leading 'L' run) - (trailing 'R' run)
+
+⏰ TIME COMPLEXITY: O(n)
+💾 SPACE COMPLEXITY: O(1)
+*/
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ROAD_SCAN_X86 1
+#endif
+
+// What one stretch of road contributes: its length, the number of moving
+// cars, and the lengths of its leading 'L' and trailing 'R' runs. Two
+// adjacent stretches combine in O(1), so a road can be summarized in
+// independent chunks, in parallel or as it streams in.
+struct RoadSummary {
+    uint64_t length = 0;
+    uint64_t moving = 0;
+    uint64_t leadingL = 0;
+    uint64_t trailingR = 0;
+
+    RoadSummary& operator+=(const RoadSummary& right) {
+
+        if (leadingL == length) {
+            leadingL += right.leadingL;
+        }
+
+        if (right.trailingR == right.length) {
+            trailingR += right.length;
+        } else {
+            trailingR = right.trailingR;
+        }
+
+        length += right.length;
+        moving += right.moving;
+
+        return *this;
+    }
+
+    uint64_t collisions() const {
+        return moving - leadingL - trailingR;
+    }
+};
+
+class RoadScan {
+public:
+    static RoadSummary summarize(string_view road) {
+
+        const char* p = road.data();
+        size_t n = road.size();
+
+        RoadSummary s;
+        s.length = n;
+        s.moving = n - countByte(p, n, 'S');
+        s.leadingL = leadingRun(p, n, 'L');
+
+        // An all-'L' stretch has no trailing 'R' run, so skip the scan.
+        s.trailingR = s.leadingL == n ? 0 : trailingRun(p, n, 'R');
+
+        return s;
+    }
+
+    // Splits the road into one contiguous chunk per thread and folds the
+    // chunk summaries left to right.
+    static RoadSummary summarize(string_view road, int threads) {
+
+        size_t n = road.size();
+
+        if (threads <= 0) {
+            threads = n < (size_t(1) << 22) ? 1 : max(1u, thread::hardware_concurrency());
+        }
+
+        threads = (int)min<size_t>(threads, max<size_t>(1, n >> 16));
+
+        if (threads == 1) {
+            return summarize(road);
+        }
+
+        vector<RoadSummary> parts(threads);
+        vector<thread> pool;
+
+        auto worker = [&](int t) {
+            size_t lo = n * t / threads;
+            size_t hi = n * (t + 1) / threads;
+            parts[t] = summarize(road.substr(lo, hi - lo));
+        };
+
+        for (int t = 1; t < threads; t++) {
+            pool.emplace_back(worker, t);
+        }
+
+        worker(0);
+
+        for (thread& th : pool) {
+            th.join();
+        }
+
+        RoadSummary total;
+
+        for (const RoadSummary& part : parts) {
+            total += part;
+        }
+
+        return total;
+    }
+
+    static uint64_t countCollisions(string_view road, int threads = 0) {
+        return summarize(road, threads).collisions();
+    }
+
+private:
+    static bool hasAvx2() {
+#ifdef ROAD_SCAN_X86
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    static size_t countByte(const char* p, size_t n, char c) {
+#ifdef ROAD_SCAN_X86
+        if (hasAvx2()) {
+            return countByteAvx2(p, n, c);
+        }
+#endif
+        return count(p, p + n, c);
+    }
+
+    static size_t leadingRun(const char* p, size_t n, char c) {
+#ifdef ROAD_SCAN_X86
+        if (hasAvx2()) {
+            return leadingRunAvx2(p, n, c);
+        }
+#endif
+        size_t i = 0;
+
+        while (i < n && p[i] == c) {
+            i++;
+        }
+
+        return i;
+    }
+
+    static size_t trailingRun(const char* p, size_t n, char c) {
+#ifdef ROAD_SCAN_X86
+        if (hasAvx2()) {
+            return trailingRunAvx2(p, n, c);
+        }
+#endif
+        size_t i = 0;
+
+        while (i < n && p[n - 1 - i] == c) {
+            i++;
+        }
+
+        return i;
+    }
+
+#ifdef ROAD_SCAN_X86
+    __attribute__((target("avx2")))
+    static uint32_t matchMask(const char* p, __m256i key) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)p);
+        return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, key));
+    }
+
+    __attribute__((target("avx2,popcnt")))
+    static size_t countByteAvx2(const char* p, size_t n, char c) {
+
+        const __m256i key = _mm256_set1_epi8(c);
+
+        size_t total = 0;
+        size_t i = 0;
+
+        for (; i + 64 <= n; i += 64) {
+            uint64_t lo = matchMask(p + i, key);
+            uint64_t hi = matchMask(p + i + 32, key);
+            total += __builtin_popcountll(lo | hi << 32);
+        }
+
+        for (; i + 32 <= n; i += 32) {
+            total += __builtin_popcount(matchMask(p + i, key));
+        }
+
+        return total + count(p + i, p + n, c);
+    }
+
+    __attribute__((target("avx2")))
+    static size_t leadingRunAvx2(const char* p, size_t n, char c) {
+
+        const __m256i key = _mm256_set1_epi8(c);
+
+        size_t i = 0;
+
+        for (; i + 32 <= n; i += 32) {
+
+            uint32_t miss = ~matchMask(p + i, key);
+
+            if (miss != 0) {
+                return i + __builtin_ctz(miss);
+            }
+        }
+
+        while (i < n && p[i] == c) {
+            i++;
+        }
+
+        return i;
+    }
+
+    __attribute__((target("avx2")))
+    static size_t trailingRunAvx2(const char* p, size_t n, char c) {
+
+        const __m256i key = _mm256_set1_epi8(c);
+
+        size_t i = 0;
+
+        for (; i + 32 <= n; i += 32) {
+
+            uint32_t miss = ~matchMask(p + n - i - 32, key);
+
+            if (miss != 0) {
+                return i + __builtin_clz(miss);
+            }
+        }
+
+        while (i < n && p[n - 1 - i] == c) {
+            i++;
+        }
+
+        return i;
+    }
+#endif
+};
+
+class Solution {
+public:
+    int countCollisions(string directions) {
+        return (int)RoadScan::countCollisions(directions, 1);
+    }
+};
\ No newline at end of file
@@ -15,17 +15,189 @@ Reverse a string in-place using O(1) extra space.
 💾 SPACE COMPLEXITY: O(1)
 */
 
-class Solution {
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define REVERSE_BYTES_X86 1
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Byte reversal kernels. swapReversed(a, b, len) exchanges a[i] with
+// b[len - 1 - i] for two non-overlapping ranges; a full reversal is one
+// such swap between the two halves. The SIMD paths load a block from each
+// end, reverse both with one byte shuffle and store them crosswise.
+class ByteReverse {
 public:
-    void reverseString(vector<char>& s) {
+    static void swapReversed(char* a, char* b, size_t len) {
+#ifdef REVERSE_BYTES_X86
+        static const int level = __builtin_cpu_supports("avx2") ? 2
+                               : __builtin_cpu_supports("ssse3") ? 1 : 0;
+
+        if (level == 2) {
+            swapReversedAvx2(a, b, len);
+            return;
+        }
+
+        if (level == 1) {
+            swapReversedSsse3(a, b, len);
+            return;
+        }
+#endif
+        swapReversedScalar(a, b, len);
+    }
+
+    static void reverse(span<char> bytes) {
+
+        size_t half = bytes.size() / 2;
+
+        swapReversed(bytes.data(), bytes.data() + bytes.size() - half, half);
+    }
+
+    // Reverses a file in place through a shared mapping. Matching chunks
+    // from both ends are swapped a pair at a time and then released, so the
+    // resident set stays at about two chunks however large the file is.
+    static bool reverseFile(const char* path, size_t chunk = size_t(1) << 20) {
+
+        int fd = open(path, O_RDWR);
+
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat st;
 
-        int left = 0;
-        int right = s.size() - 1;
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            return false;
+        }
+
+        size_t size = st.st_size;
+
+        if (size < 2) {
+            close(fd);
+            return true;
+        }
+
+        void* map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+        close(fd);
+
+        if (map == MAP_FAILED) {
+            return false;
+        }
+
+        char* data = static_cast<char*>(map);
 
-        while (left < right) {
-            swap(s[left], s[right]);
-            left++;
-            right--;
+        size_t page = sysconf(_SC_PAGESIZE);
+
+        chunk = max(page, chunk / page * page);
+
+        size_t half = size / 2;
+
+        for (size_t done = 0; done < half; done += chunk) {
+
+            size_t len = min(chunk, half - done);
+
+            char* front = data + done;
+            char* back = data + size - done - len;
+
+            swapReversed(front, back, len);
+
+            release(front, len, page);
+            release(back, len, page);
         }
+
+        return munmap(map, size) == 0;
+    }
+
+private:
+    static void swapReversedScalar(char* a, char* b, size_t len) {
+        for (size_t i = 0; i < len; i++) {
+            swap(a[i], b[len - 1 - i]);
+        }
+    }
+
+    // Drops the whole pages inside [p, p + len) from this process; the data
+    // stays in the page cache and is written back to the file as usual.
+    static void release(char* p, size_t len, size_t page) {
+
+        uintptr_t lo = ((uintptr_t)p + page - 1) / page * page;
+        uintptr_t hi = ((uintptr_t)p + len) / page * page;
+
+        if (lo < hi) {
+            madvise((void*)lo, hi - lo, MADV_DONTNEED);
+        }
+    }
+
+#ifdef REVERSE_BYTES_X86
+    __attribute__((target("ssse3")))
+    static void swapReversedSsse3(char* a, char* b, size_t len) {
+
+        const __m128i rev = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8,
+                                          7, 6, 5, 4, 3, 2, 1, 0);
+
+        size_t i = 0;
+
+        for (; i + 16 <= len; i += 16) {
+
+            char* front = a + i;
+            char* back = b + len - i - 16;
+
+            __m128i x = _mm_loadu_si128((const __m128i*)front);
+            __m128i y = _mm_loadu_si128((const __m128i*)back);
+
+            _mm_storeu_si128((__m128i*)front, _mm_shuffle_epi8(y, rev));
+            _mm_storeu_si128((__m128i*)back, _mm_shuffle_epi8(x, rev));
+        }
+
+        swapReversedScalar(a + i, b, len - i);
+    }
+
+    __attribute__((target("avx2")))
+    static void swapReversedAvx2(char* a, char* b, size_t len) {
+
+        // vpshufb works per 128-bit lane, so reverse within each lane and
+        // then swap the two lanes.
+        const __m256i rev = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8,
+                                             7, 6, 5, 4, 3, 2, 1, 0,
+                                             15, 14, 13, 12, 11, 10, 9, 8,
+                                             7, 6, 5, 4, 3, 2, 1, 0);
+
+        size_t i = 0;
+
+        for (; i + 32 <= len; i += 32) {
+
+            char* front = a + i;
+            char* back = b + len - i - 32;
+
+            __m256i x = _mm256_loadu_si256((const __m256i*)front);
+            __m256i y = _mm256_loadu_si256((const __m256i*)back);
+
+            x = _mm256_shuffle_epi8(x, rev);
+            y = _mm256_shuffle_epi8(y, rev);
+
+            x = _mm256_permute2x128_si256(x, x, 0x01);
+            y = _mm256_permute2x128_si256(y, y, 0x01);
+
+            _mm256_storeu_si256((__m256i*)front, y);
+            _mm256_storeu_si256((__m256i*)back, x);
+        }
+
+        swapReversedScalar(a + i, b, len - i);
+    }
+#endif
+};
+
+inline void reverse_bytes(span<char> bytes) {
+    ByteReverse::reverse(bytes);
+}
+
+class Solution {
+public:
+    void reverseString(vector<char>& s) {
+        reverse_bytes(s);
     }
 };
\ No newline at end of file
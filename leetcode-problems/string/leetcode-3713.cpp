@@ -11,48 +11,174 @@
 📋 PROBLEM STATEMENT:
 Find the longest substring where all distinct characters appear equal number of times.
 
-⏰ TIME COMPLEXITY: O(n² * 26)
-💾 SPACE COMPLEXITY: O(1)
+⏰ TIME COMPLEXITY: O(n²) [O(1) per window extension]
+💾 SPACE COMPLEXITY: O(1) per thread
 */
 
 class Solution {
 public:
     int longestBalanced(string s) {
+        return longestBalanced(string_view(s));
+    }
+
+    // Works directly on any contiguous character buffer, e.g. a view over a
+    // memory-mapped file, so large inputs are never copied. Only 'a'..'z'
+    // are counted; any other byte (newline, space, digit, ...) breaks the
+    // window, so the answer is the best over the runs of lowercase letters.
+    int longestBalanced(string_view s, int threads = 0) {
 
         int n = s.size();
-        int ans = 1;
 
-        for (int i = 0; i < n; i++) {
+        if (n == 0) {
+            return 0;
+        }
+
+        if (threads <= 0) {
+            threads = n < (1 << 12) ? 1 : max(1u, thread::hardware_concurrency());
+        }
 
-            vector<int> freq(26, 0);
+        atomic<int> best(0);
 
-            for (int j = i; j < n; j++) {
+        // Start positions are dealt out round-robin: early starts scan the
+        // longest windows, so striding keeps the per-thread work even.
+        auto worker = [&](int first, int step) {
 
-                freq[s[j] - 'a']++;
+            for (int i = first; i < n; i += step) {
+
+                if (n - i <= best.load(memory_order_relaxed)) {
+                    break;
+                }
+
+                int len = scanFrom(s, i, best.load(memory_order_relaxed));
+
+                int cur = best.load(memory_order_relaxed);
+
+                while (len > cur && !best.compare_exchange_weak(cur, len)) {
+                }
+            }
+        };
+
+        if (threads == 1) {
+            worker(0, 1);
+            return best.load();
+        }
 
-                int target = 0;
-                bool ok = true;
+        vector<thread> pool;
 
-                for (int k = 0; k < 26; k++) {
+        for (int t = 0; t < threads; t++) {
+            pool.emplace_back(worker, t, threads);
+        }
+
+        for (thread& th : pool) {
+            th.join();
+        }
+
+        return best.load();
+    }
+
+private:
+    // Longest balanced window starting at i, stopping at the first byte
+    // outside 'a'..'z'. A window is balanced exactly when every distinct
+    // letter sits at the maximum frequency, i.e. when countOfMax == distinct,
+    // so each extension is O(1).
+    static int scanFrom(string_view s, int i, int known) {
+
+        int freq[26] = {0};
+
+        int distinct = 0;
+        int maxFreq = 0;
+        int countOfMax = 0;
+        int ans = 0;
 
-                    if (freq[k] > 0) {
+        for (int j = i; j < (int)s.size(); j++) {
 
-                        if (target == 0) {
-                            target = freq[k];
-                        }
-                        else if (freq[k] != target) {
-                            ok = false;
-                            break;
-                        }
+            unsigned c = (unsigned char)s[j] - 'a';
+
+            if (c >= 26) {
+                break;
+            }
+
+            int f = ++freq[c];
+
+            if (f == 1) {
+                distinct++;
+            }
+
+            if (f > maxFreq) {
+                maxFreq = f;
+                countOfMax = 1;
+            }
+            else if (f == maxFreq) {
+                countOfMax++;
+            }
+
+            if (countOfMax == distinct && j - i + 1 > known) {
+                ans = j - i + 1;
+            }
+        }
+
+        return ans;
+    }
+};
+
+// Self-check for buffers that are not pure lowercase text: compares
+// longestBalanced against a brute force over each run of letters, on
+// random bytes mixed with log-like separators, for 1 and 4 threads.
+bool checkLongestBalancedNonLetters(int rounds = 2000) {
+
+    mt19937 rng(7);
+
+    auto brute = [](string_view s) {
+
+        int best = 0;
+
+        for (size_t i = 0; i < s.size(); i++) {
+
+            int freq[26] = {0};
+
+            for (size_t j = i; j < s.size() && s[j] >= 'a' && s[j] <= 'z'; j++) {
+
+                freq[s[j] - 'a']++;
+
+                int lo = INT_MAX;
+                int hi = 0;
+
+                for (int f : freq) {
+                    if (f > 0) {
+                        lo = min(lo, f);
+                        hi = max(hi, f);
                     }
                 }
 
-                if (ok) {
-                    ans = max(ans, j - i + 1);
+                if (lo == hi) {
+                    best = max(best, (int)(j - i + 1));
                 }
             }
         }
 
-        return ans;
+        return best;
+    };
+
+    const string noise = "\n /0129AZ{}`\x7f\x80\xff";
+
+    Solution solution;
+
+    for (int r = 0; r < rounds; r++) {
+
+        string s(rng() % 64, ' ');
+
+        for (char& ch : s) {
+            ch = rng() % 4 == 0 ? noise[rng() % noise.size()] : char('a' + rng() % 3);
+        }
+
+        int expected = brute(s);
+
+        if (solution.longestBalanced(string_view(s), 1) != expected ||
+            solution.longestBalanced(string_view(s), 4) != expected) {
+            return false;
+        }
     }
-};
\ No newline at end of file
+
+    return solution.longestBalanced(string_view("GET /a\n"), 1) == 1 &&
+           solution.longestBalanced(string_view("\n\n"), 1) == 0;
+}
\ No newline at end of file
@@ -34,97 +34,115 @@ Output: 3
 💾 SPACE COMPLEXITY: O(n)
 */
 
-class Node {
-public:
-    int l = 0, r = 0;
-    int mn = 0, mx = 0;
-    int lazy = 0;
+// Lazy tag policy: value_type is what the tree stores per position,
+// tag_type is a pending update. apply() must be monotone so that the
+// min/max of a segment stay the min/max after the tag is applied.
+template <class T>
+struct RangeAddPolicy {
+    using value_type = T;
+    using tag_type = T;
+
+    static tag_type identity() {
+        return 0;
+    }
+
+    static value_type apply(value_type v, tag_type t) {
+        return v + t;
+    }
+
+    static tag_type compose(tag_type older, tag_type newer) {
+        return older + newer;
+    }
 };
 
+// Range-update / min-max segment tree over positions [0, n).
+// Node u covers a range derived from the recursion, so only the min, max
+// and lazy arrays are stored; reset() keeps their capacity between uses.
+template <class Policy>
 class SegmentTree {
 public:
-    SegmentTree(int n) {
-        tr.resize(n << 2);
-        for (int i = 0; i < (int)tr.size(); ++i) {
-            tr[i] = new Node();
-        }
-        build(1, 0, n);
+    using T = typename Policy::value_type;
+    using Tag = typename Policy::tag_type;
+
+    void reset(int size, T init = T()) {
+        n = size;
+        mn.assign(n << 2, init);
+        mx.assign(n << 2, init);
+        lazy.assign(n << 2, Policy::identity());
     }
 
-    void modify(int u, int l, int r, int v) {
-        if (tr[u]->l >= l && tr[u]->r <= r) {
-            apply(u, v);
-            return;
-        }
-
-        pushdown(u);
-
-        int mid = (tr[u]->l + tr[u]->r) >> 1;
-
-        if (l <= mid) {
-            modify(u << 1, l, r, v);
-        }
+    void modify(int l, int r, Tag v) {
+        modify(1, 0, n - 1, l, r, v);
+    }
 
-        if (r > mid) {
-            modify(u << 1 | 1, l, r, v);
-        }
+    // Leftmost position holding target, assuming adjacent positions differ
+    // by at most one step (true for the prefix balances used below).
+    int query(T target) {
 
-        pushup(u);
-    }
+        int u = 1, l = 0, r = n - 1;
 
-    int query(int u, int target) {
-        if (tr[u]->l == tr[u]->r) {
-            return tr[u]->l;
-        }
+        while (l != r) {
 
-        pushdown(u);
+            pushdown(u);
 
-        int lc = u << 1;
-        int rc = u << 1 | 1;
+            int mid = (l + r) >> 1;
+            int lc = u << 1;
 
-        if (tr[lc]->mn <= target && target <= tr[lc]->mx) {
-            return query(lc, target);
+            if (mn[lc] <= target && target <= mx[lc]) {
+                u = lc;
+                r = mid;
+            }
+            else {
+                u = lc | 1;
+                l = mid + 1;
+            }
         }
 
-        return query(rc, target);
+        return l;
     }
 
 private:
-    vector<Node*> tr;
-
-    void build(int u, int l, int r) {
-        tr[u]->l = l;
-        tr[u]->r = r;
-        tr[u]->mn = 0;
-        tr[u]->mx = 0;
-        tr[u]->lazy = 0;
+    int n = 0;
+    vector<T> mn, mx;
+    vector<Tag> lazy;
 
-        if (l == r) {
+    void modify(int u, int l, int r, int ql, int qr, Tag v) {
+        if (ql <= l && r <= qr) {
+            apply(u, v);
             return;
         }
 
+        pushdown(u);
+
         int mid = (l + r) >> 1;
 
-        build(u << 1, l, mid);
-        build(u << 1 | 1, mid + 1, r);
+        if (ql <= mid) {
+            modify(u << 1, l, mid, ql, qr, v);
+        }
+
+        if (qr > mid) {
+            modify(u << 1 | 1, mid + 1, r, ql, qr, v);
+        }
+
+        pushup(u);
     }
 
-    void apply(int u, int v) {
-        tr[u]->mn += v;
-        tr[u]->mx += v;
-        tr[u]->lazy += v;
+    void apply(int u, Tag v) {
+        mn[u] = Policy::apply(mn[u], v);
+        mx[u] = Policy::apply(mx[u], v);
+        lazy[u] = Policy::compose(lazy[u], v);
     }
 
     void pushup(int u) {
-        tr[u]->mn = min(tr[u << 1]->mn, tr[u << 1 | 1]->mn);
-        tr[u]->mx = max(tr[u << 1]->mx, tr[u << 1 | 1]->mx);
+        mn[u] = min(mn[u << 1], mn[u << 1 | 1]);
+        mx[u] = max(mx[u << 1], mx[u << 1 | 1]);
     }
 
     void pushdown(int u) {
-        if (tr[u]->lazy != 0) {
-            apply(u << 1, tr[u]->lazy);
-            apply(u << 1 | 1, tr[u]->lazy);
-            tr[u]->lazy = 0;
+        if (lazy[u] != Policy::identity()) {
+            apply(u << 1, lazy[u]);
+            apply(u << 1 | 1, lazy[u]);
+            lazy[u] = Policy::identity();
         }
     }
 };
@@ -134,7 +152,7 @@ public:
     int longestBalanced(vector<int>& nums) {
         int n = nums.size();
 
-        SegmentTree st(n);
+        st.reset(n + 1);
 
         unordered_map<int, int> last;
 
@@ -148,21 +166,24 @@ public:
             int det = (x & 1) ? 1 : -1;
 
             if (last.count(x)) {
-                st.modify(1, last[x], n, -det);
+                st.modify(last[x], n, -det);
                 now -= det;
             }
 
             last[x] = i;
 
-            st.modify(1, i, n, det);
+            st.modify(i, n, det);
 
             now += det;
 
-            int pos = st.query(1, now);
+            int pos = st.query(now);
 
             ans = max(ans, i - pos);
         }
 
         return ans;
     }
+
+private:
+    SegmentTree<RangeAddPolicy<int>> st;
 };
\ No newline at end of file